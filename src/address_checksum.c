@@ -0,0 +1,26 @@
+#include "yearn_plugin.h"
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+// Records which characters of `string`, the 40 hex digits of an EIP-55 address, are uppercase.
+void address_checksum_from_string(const char *string, uint8_t *checksum) {
+    memset(checksum, 0, ADDRESS_CHECKSUM_LENGTH);
+    for (uint8_t i = 0; i < ADDRESS_LENGTH * 2; i++) {
+        if (string[i] >= 'A' && string[i] <= 'F') {
+            checksum[i / 8] |= 0x80 >> (i % 8);
+        }
+    }
+}
+
+// Writes the 40 hex digits of `address` to `out`, with the case given by `checksum`, and a '\0'.
+void address_to_checksummed_string(const uint8_t *address, const uint8_t *checksum, char *out) {
+    for (uint8_t i = 0; i < ADDRESS_LENGTH * 2; i++) {
+        uint8_t digit = i % 2 == 0 ? address[i / 2] >> 4 : address[i / 2] & 0x0f;
+        char c = HEX_DIGITS[digit];
+        if (checksum[i / 8] & (0x80 >> (i % 8))) {
+            c -= 'a' - 'A';
+        }
+        out[i] = c;
+    }
+    out[ADDRESS_LENGTH * 2] = '\0';
+}
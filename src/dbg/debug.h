@@ -2,4 +2,30 @@
 #include <stdint.h>
 
 // Printf that uses speculos semi-hosting features.
-void semihosted_printf(const char *format, ...);
\ No newline at end of file
+void semihosted_printf(const char *format, ...);
+// Writes what semihosted_printf buffered since the last '\n'.
+void semihosted_flush(void);
+
+// Traces kept in debug builds, set with `make DEBUG=1 LOG_LEVEL=<n>`:
+#define LOG_LEVEL_NONE  0  // None.
+#define LOG_LEVEL_ERROR 1  // PRINTF: why a transaction or message is refused.
+#define LOG_LEVEL_TRACE 2  // PRINTF_TRACE too: every parameter, on the hot path.
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_TRACE
+#endif
+
+#if LOG_LEVEL < LOG_LEVEL_ERROR
+#undef PRINTF
+#define PRINTF(...)
+#define PRINTF_FLUSH()
+#else
+// Before control returns to the Ethereum app or the app exits, so that the last line is not lost.
+#define PRINTF_FLUSH semihosted_flush
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_TRACE
+#define PRINTF_TRACE semihosted_printf
+#else
+#define PRINTF_TRACE(...)
+#endif
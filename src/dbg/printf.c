@@ -2,9 +2,12 @@
 #include <stdarg.h>
 #include <string.h>
 
-#if !defined(MIN)
-#define MIN(x, y) ((x) < (y) ? (x) : (y))
-#endif  // MIN
+// Every semihosting call is a supervisor call that Speculos handles outside of the emulated app, so
+// output is buffered and written one line at a time, or when the buffer is full.
+#define LINE_BUFFER_SIZE 128
+
+static char g_line[LINE_BUFFER_SIZE];
+static uint8_t g_line_len;
 
 // Prints the null terminated string pointed by `buf`.
 static void debug_write(const char *buf) {
@@ -15,32 +18,29 @@ static void debug_write(const char *buf) {
         : "r0", "r1");
 }
 
+// Writes the buffered characters, if any: the last line may not end with '\n'. Called through
+// PRINTF_FLUSH before control leaves the plugin, see src/dbg/debug.h.
+void semihosted_flush(void) {
+    if (g_line_len > 0) {
+        g_line[g_line_len] = 0;
+        debug_write(g_line);
+        g_line_len = 0;
+    }
+}
+
 // Prints a single character `c`.
 static void printc(char c) {
-    char buf[2];
-
-    buf[0] = c;
-    buf[1] = 0;
-    debug_write(buf);
+    g_line[g_line_len++] = c;
+    if (c == '\n' || g_line_len == sizeof(g_line) - 1) {
+        semihosted_flush();
+    }
 }
 
-// Prints `size` characters of `str.
+// Prints `size` characters of `str`.
 static void prints(const char *str, uint16_t size) {
-    char buf[64];
-
     while (size > 0) {
-        uint8_t written = MIN(sizeof(buf) - 1, size);
-
-        memcpy(buf, str, written);
-        buf[written] = 0;
-        debug_write(buf);
-
-        if (written >= size) {
-            size = 0;
-        } else {
-            size -= written;
-            str += written;
-        }
+        printc(*str++);
+        size--;
     }
 }
 
@@ -0,0 +1,120 @@
+#include "yearn_plugin.h"
+
+#define AMOUNT_LIMBS (INT256_LENGTH / 2)
+#define CHUNK        10000  // Digits are extracted 4 at a time, see `format_amount`.
+#define CHUNK_DIGITS 4
+
+typedef struct amount_writer_t {
+    char *out;
+    size_t out_size;
+    size_t len;         // Characters written, least significant first.
+    uint16_t position;  // Index of the next digit, 0 being the least significant one.
+    uint8_t decimals;
+    bool fraction;  // A non-zero fractional digit has been written.
+    bool overflow;
+} amount_writer_t;
+
+static void put_char(amount_writer_t *writer, char c) {
+    if (writer->len + 1 >= writer->out_size) {
+        writer->overflow = true;
+        return;
+    }
+    writer->out[writer->len++] = c;
+}
+
+// Writes the next digit, skipping the trailing zeros of the fractional part and adding the
+// decimal point before the units digit when there is a fractional part.
+static void put_digit(amount_writer_t *writer, uint8_t digit) {
+    if (writer->position < writer->decimals) {
+        if (writer->fraction || digit != 0) {
+            writer->fraction = true;
+            put_char(writer, '0' + digit);
+        }
+    } else {
+        if (writer->position == writer->decimals && writer->fraction) {
+            put_char(writer, '.');
+        }
+        put_char(writer, '0' + digit);
+    }
+    writer->position++;
+}
+
+// Writes the big-endian `amount` divided by 10^`decimals` to `out` (1500000 with 6 decimals gives
+// "1.5"), as amountToString does with an empty ticker but without its intermediate buffers.
+// Each pass divides 16-bit limbs by 10^4 so that every division fits in 32 bits; limbs that become
+// zero are skipped, so a 64-bit amount costs a quarter of a 256-bit one, and the last 32 bits are
+// converted directly. Returns false, with `out` empty, if the result does not fit in `out_size`.
+bool format_amount(const uint8_t *amount,
+                   uint8_t amount_size,
+                   uint8_t decimals,
+                   char *out,
+                   size_t out_size) {
+    uint16_t limbs[AMOUNT_LIMBS] = {0};
+    amount_writer_t writer = {out, out_size, 0, 0, decimals, false, false};
+    uint8_t first = 0;  // Index of the most significant non-zero limb.
+
+    if (out_size == 0) {
+        return false;
+    }
+    if (amount_size > INT256_LENGTH) {
+        out[0] = '\0';
+        return false;
+    }
+    for (uint8_t i = 0; i < amount_size; i++) {
+        uint8_t byte_index = amount_size - 1 - i;  // From the least significant byte.
+        limbs[AMOUNT_LIMBS - 1 - byte_index / 2] |= amount[i] << (8 * (byte_index % 2));
+    }
+    while (first < AMOUNT_LIMBS && limbs[first] == 0) {
+        first++;
+    }
+
+    while (first < AMOUNT_LIMBS) {
+        if (first >= AMOUNT_LIMBS - 2) {
+            uint32_t value = (uint32_t) limbs[AMOUNT_LIMBS - 2] << 16 | limbs[AMOUNT_LIMBS - 1];
+            while (value != 0) {
+                put_digit(&writer, value % 10);
+                value /= 10;
+            }
+            break;
+        }
+
+        uint32_t remainder = 0;
+        for (uint8_t i = first; i < AMOUNT_LIMBS; i++) {
+            uint32_t current = remainder << 16 | limbs[i];
+            limbs[i] = current / CHUNK;
+            remainder = current % CHUNK;
+        }
+        while (first < AMOUNT_LIMBS && limbs[first] == 0) {
+            first++;
+        }
+        // Leading zeros of the chunk are only written if more significant digits follow.
+        for (uint8_t i = 0; i < CHUNK_DIGITS && (first < AMOUNT_LIMBS || remainder != 0); i++) {
+            put_digit(&writer, remainder % 10);
+            remainder /= 10;
+        }
+    }
+
+    if (writer.position <= decimals) {
+        // No integer digit: "0", or "0.00ddd" with the zeros between the point and the digits.
+        if (writer.fraction) {
+            while (writer.position < decimals) {
+                put_char(&writer, '0');
+                writer.position++;
+            }
+            put_char(&writer, '.');
+        }
+        put_char(&writer, '0');
+    }
+
+    if (writer.overflow) {
+        out[0] = '\0';
+        return false;
+    }
+    for (size_t i = 0; i < writer.len / 2; i++) {
+        char c = out[i];
+        out[i] = out[writer.len - 1 - i];
+        out[writer.len - 1 - i] = c;
+    }
+    out[writer.len] = '\0';
+    return true;
+}
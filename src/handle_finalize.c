@@ -1,28 +1,89 @@
 #include "yearn_plugin.h"
 
+// Looks up the vault (or Iron Bank market) targeted by the transaction once, so that the UI
+// queries can read it from `context->vault_index` instead of searching the tables every time.
+// Only the tables (and the NVM registry) of the transaction's chain are searched: the chain ID is
+// known here, which is not always the case at init (it comes after the data in legacy
+// transactions).
+static void resolve_vault(ethPluginFinalize_t *msg, context_t *context, const flow_t *flow) {
+    ethPluginSharedRO_t *pluginSharedRO = (ethPluginSharedRO_t *) msg->pluginSharedRO;
+
+    if (flow->flags & FLOW_BATCH) {
+        // The vaults of the calls were looked up while parsing, see `get_batch_chain_index`.
+        return;
+    }
+    uint64_t chain_id = get_chain_id(pluginSharedRO->txContent);
+    context->chain_index = find_chain_index(chain_id);
+
+    if (!(flow->flags & FLOW_VAULT_FROM_CALLDATA)) {
+        copy_parameter(context->vault_address,
+                       pluginSharedRO->txContent->destination,
+                       sizeof(context->vault_address));
+    }
+    context->vault_index = find_vault(context->chain_index,
+                                      chain_id,
+                                      flow->flags & FLOW_IRON_BANK,
+                                      context->vault_address);
+
+    // Zaps get the ticker and decimals of the token sent in PROVIDE_INFO instead.
+    const yearnVaultDefinition_t *vault = get_vault_definition(context);
+    if (vault != NULL && !(flow->flags & FLOW_TOKEN_LOOKUP)) {
+        context->decimals = vault->decimals;
+    }
+}
+
 void handle_finalize(void *parameters) {
     ethPluginFinalize_t *msg = (ethPluginFinalize_t *) parameters;
     context_t *context = (context_t *) msg->pluginContext;
-    msg->numScreens = 2;  // At least 2, amount + vault
-
-    switch (context->selectorIndex) {
-        case DEPOSIT_TO:
-        case WITHDRAW_TO:
-            if (memcmp(msg->address, context->extra_address, ADDRESS_LENGTH) != 0) {
-                msg->numScreens += 1;
-            }
-            break;
-        case WITHDRAW_TO_SLIPPAGE:
-            msg->numScreens += 2;
-            break;
-        case ZAP_IN:
-            msg->tokenLookup1 = context->extra_address;
-            break;
-        case ZAP_IN_PICKLE:
-            msg->tokenLookup1 = context->extra_address;
-            break;
-        default:
-            break;
+    const flow_t *flow = get_flow(context);
+    bool vault_name = false;
+
+    resolve_vault(msg, context, flow);
+
+    if ((flow->flags & FLOW_BATCH) &&
+        (context->batch_state != BATCH_DONE ||
+         context->chain_index != get_batch_chain_index(msg->pluginSharedRO->txContent))) {
+        PRINTF("Incomplete multicall, or not on the chain its vaults were looked up in\n");
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+        return;
+    }
+    // Only zaps can name a vault of the calldata that is not in the tables, after its token. The
+    // other flows would show a raw amount and no vault, as multicall calls refuse in `end_call`.
+    if ((flow->flags & FLOW_VAULT_FROM_CALLDATA) && !(flow->flags & FLOW_TOKEN_LOOKUP) &&
+        context->vault_index == VAULT_NOT_FOUND) {
+        PRINTF("Unknown vault\n");
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+        return;
+    }
+
+    // The screens displayed are decided once here, `handle_query_contract_ui` maps screen indexes
+    // through `context->screens`.
+    msg->numScreens = 0;
+    context->screens = 0;
+    for (uint8_t i = 0; i < MAX_SCREENS && flow->screens[i] != SCREEN_NONE; i++) {
+        // The n-th SCREEN_BATCH_CALL of the flow is screen i = n, see tools/gen_registry.py.
+        if ((flow->screens[i] & SCREEN_MASK) == SCREEN_BATCH_CALL && i >= context->batch_count) {
+            continue;
+        }
+        const uint8_t *address = context->extra_address;
+        if ((flow->screens[i] & SCREEN_MASK) == SCREEN_OWNER) {
+            address = context->owner;
+        }
+        if ((flow->screens[i] & SCREEN_IF_NOT_SENDER) &&
+            memcmp(msg->address, address, ADDRESS_LENGTH) == 0) {
+            continue;
+        }
+        context->screens |= 1 << i;
+        msg->numScreens++;
+        vault_name |= (flow->screens[i] & SCREEN_MASK) == SCREEN_VAULT_NAME;
+    }
+
+    if (flow->flags & FLOW_TOKEN_LOOKUP) {
+        msg->tokenLookup1 = context->extra_address;
+        // A vault missing from the tables is named after its token, in the same PROVIDE_INFO.
+        if (vault_name && context->vault_index == VAULT_NOT_FOUND) {
+            msg->tokenLookup2 = context->vault_address;
+        }
     }
     msg->uiType = ETH_UI_TYPE_GENERIC;
     msg->result = ETH_PLUGIN_RESULT_OK;
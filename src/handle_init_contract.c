@@ -1,4 +1,23 @@
 #include "yearn_plugin.h"
+#include "selector_hash.h"
+
+// Slot of `selector` in SELECTOR_HASH_TABLE, generated by tools/gen_registry.py.
+static uint8_t selector_hash(const uint8_t *selector) {
+    uint32_t value = ((uint32_t) selector[0] << 24) | ((uint32_t) selector[1] << 16) |
+                     ((uint32_t) selector[2] << 8) | (uint32_t) selector[3];
+    return (uint8_t) ((value * SELECTOR_HASH_MULTIPLIER) >> (32 - SELECTOR_HASH_BITS));
+}
+
+// Returns the index of `selector` in YEARN_SELECTORS, or SELECTOR_NOT_FOUND. The perfect hash is
+// generated at build time: a single candidate to compare against.
+uint8_t find_selector_index(const uint8_t *selector) {
+    uint8_t i = SELECTOR_HASH_TABLE[selector_hash(selector)];
+    if (i != SELECTOR_NOT_FOUND &&
+        memcmp((uint8_t *) PIC(YEARN_SELECTORS[i]), selector, SELECTOR_SIZE) == 0) {
+        return i;
+    }
+    return SELECTOR_NOT_FOUND;
+}
 
 // Called once to init.
 void handle_init_contract(void *parameters) {
@@ -17,45 +36,25 @@ void handle_init_contract(void *parameters) {
 
     context_t *context = (context_t *) msg->pluginContext;
     memset(context, 0, sizeof(*context));
+    context->vault_index = VAULT_NOT_FOUND;
 
-    uint8_t i;
-    for (i = 0; i < NUM_SELECTORS; i++) {
-        if (memcmp((uint8_t *) PIC(YEARN_SELECTORS[i]), msg->selector, SELECTOR_SIZE) == 0) {
-            context->selectorIndex = i;
-            break;
-        }
-    }
-    if (i == NUM_SELECTORS) {
+    uint8_t i = find_selector_index(msg->selector);
+    if (i == SELECTOR_NOT_FOUND) {
+        PRINTF("Unknown selector\n");
         msg->result = ETH_PLUGIN_RESULT_UNAVAILABLE;
+        return;
     }
+    context->selectorIndex = i;
 
-    switch (context->selectorIndex) {
-        case DEPOSIT_ALL:
-        case WITHDRAW_ALL:
-        case CLAIM:
-        case EXIT:
-        case GET_REWARDS:
-            break;
-        case DEPOSIT:
-        case DEPOSIT_TO:
-        case WITHDRAW:
-        case WITHDRAW_TO:
-        case WITHDRAW_TO_SLIPPAGE:
-        case IB_MINT:
-        case IB_REDEEM:
-        case IB_REDEEM_UNDERLYING:
-        case IB_BORROW:
-        case IB_REPAY_BORROW:
-            context->next_param = AMOUNT;
-            break;
-        case ZAP_IN:
-        case ZAP_IN_PICKLE:
-            context->next_param = ZAP_TOKEN;
-            break;
-        default:
-            PRINTF("Missing selectorIndex: %d\n", context->selectorIndex);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            return;
+    // Fail fast on contracts the registry does not list, whatever their selector: none of the
+    // following messages could display them.
+    if (!is_known_destination(msg->pluginSharedRO->txContent->destination)) {
+        PRINTF("Unknown destination\n");
+        msg->result = ETH_PLUGIN_RESULT_UNAVAILABLE;
+        return;
     }
+
+    // Nothing else to set up per selector: parameters are parsed from the first slot of
+    // PARAMETER_SCHEMAS[selectorIndex], next_param is already 0.
     msg->result = ETH_PLUGIN_RESULT_OK;
 }
@@ -1,174 +1,69 @@
 #include "yearn_plugin.h"
 
-static void handle_deposit(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_deposit_to(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            context->next_param = RECIPIENT;
-            break;
-        case RECIPIENT:
-            copy_address(context->extra_address, msg->parameter, sizeof(context->extra_address));
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_withdraw(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_withdraw_to(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            context->next_param = RECIPIENT;
-            break;
-        case RECIPIENT:
-            copy_address(context->extra_address, msg->parameter, sizeof(context->extra_address));
-            context->next_param = UNEXPECTED_PARAMETER;
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_withdraw_to_slippage(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            context->next_param = RECIPIENT;
-            break;
-        case RECIPIENT:
-            copy_address(context->extra_address, msg->parameter, sizeof(context->extra_address));
-            context->next_param = SLIPPAGE;
-            break;
-        case SLIPPAGE:
-            copy_parameter(context->slippage, msg->parameter, sizeof(context->slippage));
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_zap_in(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case ZAP_TOKEN:
-            copy_address(context->extra_address, msg->parameter, sizeof(context->extra_address));
-            context->next_param = ZAP_AMOUNT;
-            break;
-        case ZAP_AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            context->next_param = ZAP_TO_VAULT;
-            break;
-        case ZAP_TO_VAULT:
-            copy_address(context->vault_address, msg->parameter, sizeof(context->vault_address));
-            context->next_param = ZAP_REST;
-            break;
-        case ZAP_REST:
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_iron_bank(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        case AMOUNT:
-            copy_parameter(context->amount, msg->parameter, sizeof(context->amount));
-            break;
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
-    }
-}
-
-static void handle_none(ethPluginProvideParameter_t *msg, context_t *context) {
-    switch (context->next_param) {
-        default:
-            PRINTF("Param not supported: %d\n", context->next_param);
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
+// Copies a uint256 parameter to the uint16_t at `field`. Returns false if it does not fit.
+static bool copy_uint16_parameter(uint8_t *field, const uint8_t *parameter) {
+    for (uint8_t i = 0; i < PARAMETER_LENGTH - sizeof(uint16_t); i++) {
+        if (parameter[i] != 0) {
+            return false;
+        }
     }
+    uint16_t value = parameter[PARAMETER_LENGTH - 2] << 8 | parameter[PARAMETER_LENGTH - 1];
+    memcpy(field, &value, sizeof(value));
+    return true;
 }
 
+// Parameters are not parsed per selector: each calldata word is stored according to its slot in
+// PARAMETER_SCHEMAS, generated from the "params" of registry/yearn.json.
 void handle_provide_parameter(void *parameters) {
     ethPluginProvideParameter_t *msg = (ethPluginProvideParameter_t *) parameters;
     context_t *context = (context_t *) msg->pluginContext;
 
-    PRINTF("plugin provide parameter: offset %d\nBytes: %.*H\n",
-           msg->parameterOffset,
-           PARAMETER_LENGTH,
-           msg->parameter);
+    PRINTF_TRACE("plugin provide parameter: offset %d\nBytes: %.*H\n",
+                 msg->parameterOffset,
+                 PARAMETER_LENGTH,
+                 msg->parameter);
 
     msg->result = ETH_PLUGIN_RESULT_OK;
 
-    switch (context->selectorIndex) {
-        case WITHDRAW_ALL:
-        case DEPOSIT_ALL:
-        case CLAIM:
-        case EXIT:
-        case GET_REWARDS:
-            handle_none(msg, context);
-            break;
-        case DEPOSIT:
-            handle_deposit(msg, context);
-            break;
-        case DEPOSIT_TO:
-            handle_deposit_to(msg, context);
-            break;
-        case WITHDRAW:
-            handle_withdraw(msg, context);
-            break;
-        case WITHDRAW_TO:
-            handle_withdraw_to(msg, context);
-            break;
-        case WITHDRAW_TO_SLIPPAGE:
-            handle_withdraw_to_slippage(msg, context);
-            break;
-        case ZAP_IN:
-        case ZAP_IN_PICKLE:
-            handle_zap_in(msg, context);
-            break;
-        case IB_MINT:
-        case IB_REDEEM:
-        case IB_REDEEM_UNDERLYING:
-        case IB_BORROW:
-        case IB_REPAY_BORROW:
-            handle_iron_bank(msg, context);
-            break;
+    if (context->selectorIndex >= NUM_SELECTORS || context->next_param >= MAX_PARAMS) {
+        PRINTF("Param not supported: %d\n", context->next_param);
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+        return;
+    }
+    const param_slot_t *slot =
+        (const param_slot_t *) PIC(&PARAMETER_SCHEMAS[context->selectorIndex][context->next_param]);
+    uint8_t *field = (uint8_t *) context + slot->field;
+
+    switch (slot->kind) {
+        case PARAM_UINT256:
+            copy_parameter(field, msg->parameter, INT256_LENGTH);
+            break;
+        case PARAM_ADDRESS:
+            copy_address(field, msg->parameter, ADDRESS_LENGTH);
+            break;
+        case PARAM_UINT16:
+            // The slippage, in basis points: the vault reverts above 10000, anything not fitting
+            // in 16 bits is refused rather than displayed.
+            if (!copy_uint16_parameter(field, msg->parameter)) {
+                PRINTF("Param out of range: %d\n", context->next_param);
+                msg->result = ETH_PLUGIN_RESULT_ERROR;
+                return;
+            }
+            break;
+        case PARAM_SKIP:
+            break;
+        case PARAM_REST:
+            return;  // Stay on this slot for the following words.
+        case PARAM_CALLS:
+            // Stay on this slot too: the calls of a multicall have their own parser.
+            if (!parse_batch_word(context, msg->parameter, msg->pluginSharedRO->txContent)) {
+                msg->result = ETH_PLUGIN_RESULT_ERROR;
+            }
+            return;
         default:
-            PRINTF("Selector Index not supported: %d\n", context->selectorIndex);
+            PRINTF("Param not supported: %d\n", context->next_param);
             msg->result = ETH_PLUGIN_RESULT_ERROR;
-            break;
+            return;
     }
-}
\ No newline at end of file
+    context->next_param++;
+}
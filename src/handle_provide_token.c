@@ -4,19 +4,39 @@ const uint8_t NULL_ETH_ADDRESS[ADDRESS_LENGTH] = {0x00, 0x00, 0x00, 0x00, 0x00,
                                                   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                                                   0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+// item1 is the token sent by a zap, item2 the vault it deposits to when that vault is missing from
+// the tables, both requested in a single round trip by `handle_finalize`. The want token of such a
+// vault cannot be requested instead: its address is neither in the calldata nor in the registry.
 void handle_provide_token(void *parameters) {
     ethPluginProvideInfo_t *msg = (ethPluginProvideInfo_t *) parameters;
     context_t *context = (context_t *) msg->pluginContext;
+    const zapTokenDefinition_t *token;
 
     if (memcmp(context->extra_address, NULL_ETH_ADDRESS, ADDRESS_LENGTH) == 0) {
+        // The coin of the transaction's chain, which has 18 decimals on every EVM chain.
         context->decimals = 18;
-        strlcpy(context->want, "ETH", sizeof(context->want));
+        copy_native_ticker(context->chain_index,
+                           context->token_ticker,
+                           sizeof(context->token_ticker));
     } else if (msg->item1) {
         context->decimals = msg->item1->token.decimals;
-        strlcpy(context->want, (char *) msg->item1->token.ticker, sizeof(context->want));
+        strlcpy(context->token_ticker,
+                (char *) msg->item1->token.ticker,
+                sizeof(context->token_ticker));
+    } else if ((token = get_zap_token(context)) != NULL) {
+        context->decimals = token->decimals;
+        copy_zap_token_ticker(token, context->token_ticker, sizeof(context->token_ticker));
     } else {
         context->decimals = 18;
-        strlcpy(context->want, "???", sizeof(context->want));
+        strlcpy(context->token_ticker, "???", sizeof(context->token_ticker));
+    }
+
+    // `vault_ticker` shares its bytes with the calls of a multicall.
+    if (msg->item2 && (get_flow(context)->flags & FLOW_TOKEN_LOOKUP) &&
+        context->vault_index == VAULT_NOT_FOUND) {
+        strlcpy(context->vault_ticker,
+                (char *) msg->item2->token.ticker,
+                sizeof(context->vault_ticker));
     }
 
     msg->result = ETH_PLUGIN_RESULT_OK;
@@ -1,32 +1,72 @@
 #include "yearn_plugin.h"
 
-void copy_amount_with_ticker(const uint8_t *amount,
-                             uint8_t amount_size,
-                             uint8_t amount_decimals,
-                             char *ticker,
-                             uint8_t ticker_size,
-                             char *out_buffer,
-                             uint8_t out_buffer_size) {
-    char tmp_buffer[100] = {0};
-    amountToString(amount, amount_size, amount_decimals, "", tmp_buffer, 100);
-    uint8_t amount_len = strnlen(tmp_buffer, sizeof(tmp_buffer));
-    memcpy(out_buffer, tmp_buffer, amount_len);
-    memcpy(out_buffer + amount_len, " ", 1);
-    memcpy(out_buffer + amount_len + 1, ticker, ticker_size);
-    out_buffer[out_buffer_size - 1] = '\0';
+// Appends at most `string_len` characters of `string` to `out_buffer`, which holds `len`
+// characters, truncating to fit. Returns the new length; `out_buffer` is NUL-terminated.
+static size_t append_string(char *out_buffer,
+                            size_t out_buffer_size,
+                            size_t len,
+                            const char *string,
+                            size_t string_len) {
+    string_len = MIN(string_len, out_buffer_size - 1 - len);
+    memcpy(out_buffer + len, string, string_len);
+    len += string_len;
+    out_buffer[len] = '\0';
+    return len;
 }
 
-void copy_vault_name(const char *vaultName,
-                     uint8_t vaultName_size,
-                     char *out_buffer,
-                     uint8_t out_buffer_size) {
-    char tmp_buffer[100] = {0};
+// Marks the only screen failure that `handle_finalize` cannot rule out when it counts the screens:
+// an amount too long for its screen. The host build counts them, see tests/host/fuzz_dispatch.c.
+#ifndef AMOUNT_TOO_LONG
+#define AMOUNT_TOO_LONG()
+#endif
 
-    strlcpy(tmp_buffer, vaultName, vaultName_size);
-    uint8_t amount_len = strnlen(tmp_buffer, sizeof(tmp_buffer));
-    memcpy(out_buffer, tmp_buffer, amount_len);
-    memcpy(out_buffer + amount_len, " vault", 6);
-    out_buffer[out_buffer_size - 1] = '\0';
+// Writes "<amount> <ticker>" to `out_buffer`. The amount is formatted in place, the ticker is
+// appended after it. Returns false, with `out_buffer` empty, if the amount does not fit: a ticker
+// alone must never be shown.
+static bool copy_amount_with_ticker(const uint8_t *amount,
+                                    uint8_t amount_size,
+                                    uint8_t amount_decimals,
+                                    const char *ticker,
+                                    uint8_t ticker_size,
+                                    char *out_buffer,
+                                    uint8_t out_buffer_size) {
+    if (!format_amount(amount, amount_size, amount_decimals, out_buffer, out_buffer_size)) {
+        PRINTF("Amount does not fit on the screen\n");
+        AMOUNT_TOO_LONG();
+        return false;
+    }
+    size_t len = strlen(out_buffer);
+    len = append_string(out_buffer, out_buffer_size, len, " ", 1);
+    append_string(out_buffer, out_buffer_size, len, ticker, strnlen(ticker, ticker_size));
+    return true;
+}
+
+// Copies the name of the vault (or Iron Bank market) resolved in `handle_finalize` to `out`. A
+// zap to a vault missing from the tables gets the ticker received in PROVIDE_INFO, if any; the
+// name is empty otherwise, see `set_vault_name`. `out` must hold MAX_VAULT_TICKER_LEN bytes.
+static const char *get_vault_ticker(context_t *context, char *out) {
+    const yearnVaultDefinition_t *vault = get_vault_definition(context);
+    out[0] = '\0';
+    if (vault != NULL) {
+        copy_vault_name_string(vault, out, MAX_VAULT_TICKER_LEN);
+    } else if (get_flow(context)->flags & FLOW_TOKEN_LOOKUP) {
+        strlcpy(out, context->vault_ticker, MAX_VAULT_TICKER_LEN);
+    }
+    return out;
+}
+
+// Returns the ticker of the token deposited: the token received in PROVIDE_INFO for zaps, the want
+// token of the vault otherwise, empty if unknown. `out` must hold MAX_VAULT_TICKER_LEN bytes.
+static const char *get_want_ticker(context_t *context, char *out) {
+    if (get_flow(context)->flags & FLOW_TOKEN_LOOKUP) {
+        return context->token_ticker;
+    }
+    const yearnVaultDefinition_t *vault = get_vault_definition(context);
+    out[0] = '\0';
+    if (vault != NULL) {
+        copy_vault_want(vault, out, MAX_VAULT_TICKER_LEN);
+    }
+    return out;
 }
 
 /******************************************************************************
@@ -35,14 +75,33 @@ void copy_vault_name(const char *vaultName,
 **  |   10 %   |
 ******************************************************************************/
 static void set_slippage_ui(ethQueryContractUI_t *msg, context_t *context) {
+    uint8_t slippage[sizeof(context->slippage)] = {context->slippage >> 8,
+                                                   context->slippage & 0xff};
     strlcpy(msg->title, "Slippage", msg->titleLength);
-    copy_amount_with_ticker(context->slippage,
-                            sizeof(context->slippage),
-                            2,
-                            "%",
-                            1,
-                            msg->msg,
-                            msg->msgLength);
+    if (!copy_amount_with_ticker(slippage, sizeof(slippage), 2, "%", 1, msg->msg, msg->msgLength)) {
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+    }
+}
+
+// Writes "0x" and the checksummed `address` to msg->msg. The Keccak-256 hash is only computed the
+// first time, its result is kept in `checksum` for the next displays of the screen.
+static void set_address(ethQueryContractUI_t *msg,
+                        context_t *context,
+                        const uint8_t *address,
+                        uint8_t *checksum,
+                        uint8_t checksum_flag) {
+    msg->msg[0] = '0';
+    msg->msg[1] = 'x';
+    if (context->checksums & checksum_flag) {
+        address_to_checksummed_string(address, checksum, msg->msg + 2);
+        return;
+    }
+    getEthAddressStringFromBinary((uint8_t *) address,
+                                  msg->msg + 2,
+                                  msg->pluginSharedRW->sha3,
+                                  get_chain_id(msg->pluginSharedRO->txContent));
+    address_checksum_from_string(msg->msg + 2, checksum);
+    context->checksums |= checksum_flag;
 }
 
 /******************************************************************************
@@ -52,13 +111,21 @@ static void set_slippage_ui(ethQueryContractUI_t *msg, context_t *context) {
 ******************************************************************************/
 static void set_recipient_ui(ethQueryContractUI_t *msg, context_t *context) {
     strlcpy(msg->title, "Recipient", msg->titleLength);
-    msg->msg[0] = '0';
-    msg->msg[1] = 'x';
-    uint64_t chainid = 0;
-    getEthAddressStringFromBinary(context->extra_address,
-                                  msg->msg + 2,
-                                  msg->pluginSharedRW->sha3,
-                                  chainid);
+    set_address(msg,
+                context,
+                context->extra_address,
+                context->recipient_checksum,
+                CHECKSUM_RECIPIENT);
+}
+
+/******************************************************************************
+**  Will display the owner of the shares burnt (ERC-4626 withdraw and redeem)
+**  |                     Owner                    |
+**  |  0x28bC240B2433B65d3C64EBF168862E60fAb019E4  |
+******************************************************************************/
+static void set_owner_ui(ethQueryContractUI_t *msg, context_t *context) {
+    strlcpy(msg->title, "Owner", msg->titleLength);
+    set_address(msg, context, context->owner, context->owner_checksum, CHECKSUM_OWNER);
 }
 
 /******************************************************************************
@@ -67,15 +134,17 @@ static void set_recipient_ui(ethQueryContractUI_t *msg, context_t *context) {
 **  |  0x28bC240B2433B65d3C64EBF168862E60fAb019E4  |
 ******************************************************************************/
 static void set_vault_ui(ethQueryContractUI_t *msg, context_t *context) {
-    strlcpy(msg->title, "Vault", msg->titleLength);
+    const yearnVaultDefinition_t *vault = get_vault_definition(context);
 
-    msg->msg[0] = '0';
-    msg->msg[1] = 'x';
-    uint64_t chainid = 0;
-    getEthAddressStringFromBinary(context->vault_address,
-                                  msg->msg + 2,
-                                  msg->pluginSharedRW->sha3,
-                                  chainid);
+    strlcpy(msg->title, "Vault", msg->titleLength);
+    if (vault != NULL) {
+        // Known vault: the checksum was computed by tools/gen_registry.py.
+        msg->msg[0] = '0';
+        msg->msg[1] = 'x';
+        address_to_checksummed_string(vault->address, vault->checksum, msg->msg + 2);
+        return;
+    }
+    set_address(msg, context, context->vault_address, context->vault_checksum, CHECKSUM_VAULT);
 }
 
 /******************************************************************************
@@ -84,14 +153,17 @@ static void set_vault_ui(ethQueryContractUI_t *msg, context_t *context) {
 **  |  200 DAI  |
 ******************************************************************************/
 static void set_amount_with_want(ethQueryContractUI_t *msg, context_t *context) {
+    char ticker[MAX_VAULT_TICKER_LEN];
     strlcpy(msg->title, "Amount", msg->titleLength);
-    copy_amount_with_ticker(context->amount,
-                            sizeof(context->amount),
-                            context->decimals,
-                            context->want,
-                            sizeof(context->want),
-                            msg->msg,
-                            msg->msgLength);
+    if (!copy_amount_with_ticker(context->amount,
+                                 sizeof(context->amount),
+                                 context->decimals,
+                                 get_want_ticker(context, ticker),
+                                 MAX_VAULT_TICKER_LEN,
+                                 msg->msg,
+                                 msg->msgLength)) {
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+    }
 }
 
 /******************************************************************************
@@ -100,14 +172,17 @@ static void set_amount_with_want(ethQueryContractUI_t *msg, context_t *context)
 **  |  200 yvDAI  |
 ******************************************************************************/
 static void set_amount_with_vault(ethQueryContractUI_t *msg, context_t *context) {
+    char ticker[MAX_VAULT_TICKER_LEN];
     strlcpy(msg->title, "Amount", msg->titleLength);
-    copy_amount_with_ticker(context->amount,
-                            sizeof(context->amount),
-                            context->decimals,
-                            context->vault,
-                            sizeof(context->vault),
-                            msg->msg,
-                            msg->msgLength);
+    if (!copy_amount_with_ticker(context->amount,
+                                 sizeof(context->amount),
+                                 context->decimals,
+                                 get_vault_ticker(context, ticker),
+                                 MAX_VAULT_TICKER_LEN,
+                                 msg->msg,
+                                 msg->msgLength)) {
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+    }
 }
 
 /******************************************************************************
@@ -116,14 +191,17 @@ static void set_amount_with_vault(ethQueryContractUI_t *msg, context_t *context)
 **  |  200 yvDAI  |
 ******************************************************************************/
 static void set_amount_with_bank(ethQueryContractUI_t *msg, context_t *context) {
+    char ticker[MAX_VAULT_TICKER_LEN];
     strlcpy(msg->title, "Amount", msg->titleLength);
-    copy_amount_with_ticker(context->amount,
-                            sizeof(context->amount),
-                            8,
-                            context->vault,
-                            sizeof(context->vault),
-                            msg->msg,
-                            msg->msgLength);
+    if (!copy_amount_with_ticker(context->amount,
+                                 sizeof(context->amount),
+                                 8,
+                                 get_vault_ticker(context, ticker),
+                                 MAX_VAULT_TICKER_LEN,
+                                 msg->msg,
+                                 msg->msgLength)) {
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+    }
 }
 
 /******************************************************************************
@@ -138,181 +216,158 @@ static void set_amount_with_all(ethQueryContractUI_t *msg) {
 }
 
 /******************************************************************************
-**  Will display the Vault name. The vaults are defined in main.c in the
-**  YEARN_VAULTS variable.
+**  Will display the Vault name. The vaults are listed in
+**  registry/yearn.json. A zap to a vault that has no name, in the tables or in
+**  the tokens of the Ethereum app, displays its address instead.
 **  | Vault |
 **  | yvDAI |
 ******************************************************************************/
 static void set_vault_name(ethQueryContractUI_t *msg, context_t *context) {
+    char ticker[MAX_VAULT_TICKER_LEN];
+    if (get_vault_ticker(context, ticker)[0] == '\0') {
+        set_vault_ui(msg, context);
+        return;
+    }
     strlcpy(msg->title, "Vault", msg->titleLength);
-    strlcpy(msg->msg, context->vault, msg->msgLength);
+    strlcpy(msg->msg, ticker, msg->msgLength);
 }
 
 /******************************************************************************
-**  Will display the Bank name. The banks are defined in main.c in the
-**  IRON_BANK variable.
+**  Will display the Bank name. The banks are listed in
+**  registry/yearn.json.
 **  |  BANK  |
 **  | cyWETH |
 ******************************************************************************/
 static void set_bank_name(ethQueryContractUI_t *msg, context_t *context) {
+    char ticker[MAX_VAULT_TICKER_LEN];
     strlcpy(msg->title, "Market", msg->titleLength);
-    strlcpy(msg->msg, context->vault, msg->msgLength);
+    strlcpy(msg->msg, get_vault_ticker(context, ticker), msg->msgLength);
 }
 
-void handle_query_contract_ui_zap_in(ethQueryContractUI_t *msg, context_t *context) {
-    uint8_t i;
-    yearnVaultDefinition_t *currentVault = NULL;
-    for (i = 0; i < NUM_YEARN_VAULTS; i++) {
-        currentVault = (yearnVaultDefinition_t *) PIC(&YEARN_VAULTS[i]);
-        if (memcmp(currentVault->address, context->vault_address, ADDRESS_LENGTH) == 0) {
-            memcpy(context->vault, currentVault->vault, MAX_VAULT_TICKER_LEN);
-            break;
-        }
-    }
-
-    switch (msg->screenIndex) {
-        case 0:
-            set_amount_with_want(msg, context);
-            break;
-        case 1:
-            if (context->selectorIndex == ZAP_IN_PICKLE) {
-                strlcpy(msg->title, "Vault", msg->titleLength);
-                strlcpy(msg->msg, "pSLPyvBOOST-ETH", msg->msgLength);
-                break;
-            }
-            set_vault_name(msg, context);
-            break;
-        default:
-            PRINTF("Received an invalid screenIndex\n");
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            return;
-    }
+/******************************************************************************
+**  Will display the vault the Pickle zap deposits to.
+**  |      Vault      |
+**  | pSLPyvBOOST-ETH |
+******************************************************************************/
+static void set_pickle_vault_name(ethQueryContractUI_t *msg) {
+    strlcpy(msg->title, "Vault", msg->titleLength);
+    strlcpy(msg->msg, "pSLPyvBOOST-ETH", msg->msgLength);
 }
 
-void handle_query_contract_ui_vaults(ethQueryContractUI_t *msg, context_t *context) {
-    // Copy the vault address prior to any process
-    ethPluginSharedRO_t *pluginSharedRO = (ethPluginSharedRO_t *) msg->pluginSharedRO;
-    copy_parameter(context->vault_address,
-                   pluginSharedRO->txContent->destination,
-                   sizeof(context->vault_address));
+/******************************************************************************
+**  Will display one call of a multicall: what it does, its amount and vault.
+**  |            Call 1/2           |
+**  |  Deposit 200 DAI, yvDAI       |
+******************************************************************************/
+static void set_batch_call_ui(ethQueryContractUI_t *msg, context_t *context, uint8_t call) {
+    const batch_call_t *batch_call = &context->calls[call];
+    const flow_t *flow = (const flow_t *) PIC(&FLOWS[batch_call->selectorIndex]);
+    const yearnVaultDefinition_t *vault = get_batch_vault_definition(context, call);
+    char title[] = "Call ?/?";
+    char ticker[MAX_VAULT_TICKER_LEN];
+    size_t len;
 
-    // find information about vault
-    uint8_t i;
-    yearnVaultDefinition_t *currentVault = NULL;
-    for (i = 0; i < NUM_YEARN_VAULTS; i++) {
-        currentVault = (yearnVaultDefinition_t *) PIC(&YEARN_VAULTS[i]);
-        if (memcmp(currentVault->address, context->vault_address, ADDRESS_LENGTH) == 0) {
-            context->decimals = currentVault->decimals;
-            memcpy(context->want, currentVault->want, MAX_VAULT_TICKER_LEN);
-            memcpy(context->vault, currentVault->vault, MAX_VAULT_TICKER_LEN);
-            break;
-        }
+    // An NVM registry entry can be gone since the multicall was parsed (wiped or replaced).
+    if (vault == NULL) {
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+        return;
     }
-    switch (msg->screenIndex) {
-        case 0:
-            switch (context->selectorIndex) {
-                case WITHDRAW_ALL:
-                case DEPOSIT_ALL:
-                case CLAIM:
-                case GET_REWARDS:
-                case EXIT:
-                    set_amount_with_all(msg);
-                    break;
-                case DEPOSIT_TO:
-                case DEPOSIT:
-                    set_amount_with_want(msg, context);
-                    break;
-                case WITHDRAW_TO_SLIPPAGE:
-                case WITHDRAW_TO:
-                case WITHDRAW:
-                    set_amount_with_vault(msg, context);
-                    break;
-                default:
-                    break;
-            }
-            break;
-        case 1:
-            set_vault_name(msg, context);
-            break;
-        case 2:
-            set_recipient_ui(msg, context);
-            break;
-        case 3:
-            set_slippage_ui(msg, context);
-            break;
-        // Keep this
-        default:
-            PRINTF("Received an invalid screenIndex\n");
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            return;
+    title[5] = '1' + call;
+    title[7] = '0' + context->batch_count;
+    strlcpy(msg->title, title, msg->titleLength);
+
+    if ((flow->screens[0] & SCREEN_MASK) == SCREEN_AMOUNT_WANT) {
+        copy_vault_want(vault, ticker, sizeof(ticker));
+    } else {
+        copy_vault_name_string(vault, ticker, sizeof(ticker));
+    }
+    const char *version = (const char *) PIC(flow->version);
+    len = append_string(msg->msg, msg->msgLength, 0, version, strlen(version));
+    len = append_string(msg->msg, msg->msgLength, len, " ", 1);
+    if (!copy_amount_with_ticker(batch_call->amount,
+                                 sizeof(batch_call->amount),
+                                 vault->decimals,
+                                 ticker,
+                                 sizeof(ticker),
+                                 msg->msg + len,
+                                 msg->msgLength - len)) {
+        msg->result = ETH_PLUGIN_RESULT_ERROR;
+        return;
     }
+    len += strlen(msg->msg + len);
+    len = append_string(msg->msg, msg->msgLength, len, ", ", 2);
+    copy_vault_name_string(vault, ticker, sizeof(ticker));
+    append_string(msg->msg, msg->msgLength, len, ticker, strlen(ticker));
 }
 
-void handle_query_contract_ui_ironbank(ethQueryContractUI_t *msg, context_t *context) {
-    ethPluginSharedRO_t *pluginSharedRO = (ethPluginSharedRO_t *) msg->pluginSharedRO;
-    copy_parameter(context->vault_address,
-                   pluginSharedRO->txContent->destination,
-                   sizeof(context->vault_address));
+// Returns the `screen_t` displayed at `screen_index`, skipping the screens of the flow that
+// `handle_finalize` left out, or SCREEN_NONE if there is no such screen. `position` is set to its
+// index in the flow.
+static uint8_t get_screen(const context_t *context, uint8_t screen_index, uint8_t *position) {
+    const flow_t *flow = get_flow(context);
 
-    uint8_t i;
-    yearnVaultDefinition_t *currentVault = NULL;
-    for (i = 0; i < NUM_IRON_BANK; i++) {
-        currentVault = (yearnVaultDefinition_t *) PIC(&IRON_BANK[i]);
-        if (memcmp(currentVault->address, context->vault_address, ADDRESS_LENGTH) == 0) {
-            context->decimals = currentVault->decimals;
-            memcpy(context->want, currentVault->want, MAX_VAULT_TICKER_LEN);
-            memcpy(context->vault, currentVault->vault, MAX_VAULT_TICKER_LEN);
-            break;
-        }
-    }
-    switch (msg->screenIndex) {
-        case 0:
-            switch (context->selectorIndex) {
-                case IB_MINT:
-                case IB_REDEEM_UNDERLYING:
-                    set_amount_with_want(msg, context);
-                    break;
-                case IB_REDEEM:
-                case IB_BORROW:
-                case IB_REPAY_BORROW:
-                    set_amount_with_bank(msg, context);
-                    break;
-                default:
-                    break;
+    for (uint8_t i = 0; i < MAX_SCREENS; i++) {
+        if (context->screens & (1 << i)) {
+            if (screen_index == 0) {
+                *position = i;
+                return flow->screens[i] & SCREEN_MASK;
             }
-            break;
-        case 1:
-            set_bank_name(msg, context);
-            break;
-        default:
-            PRINTF("Received an invalid screenIndex\n");
-            msg->result = ETH_PLUGIN_RESULT_ERROR;
-            return;
+            screen_index--;
+        }
     }
+    return SCREEN_NONE;
 }
 
 void handle_query_contract_ui(void *parameters) {
     ethQueryContractUI_t *msg = (ethQueryContractUI_t *) parameters;
     context_t *context = (context_t *) msg->pluginContext;
+    uint8_t position = 0;
     memset(msg->title, 0, msg->titleLength);
     memset(msg->msg, 0, msg->msgLength);
 
     msg->result = ETH_PLUGIN_RESULT_OK;
 
-    switch (context->selectorIndex) {
-        case ZAP_IN:
-        case ZAP_IN_PICKLE:
-            handle_query_contract_ui_zap_in(msg, context);
+    switch (get_screen(context, msg->screenIndex, &position)) {
+        case SCREEN_AMOUNT_ALL:
+            set_amount_with_all(msg);
+            break;
+        case SCREEN_AMOUNT_WANT:
+            set_amount_with_want(msg, context);
+            break;
+        case SCREEN_AMOUNT_VAULT:
+            set_amount_with_vault(msg, context);
+            break;
+        case SCREEN_AMOUNT_BANK:
+            set_amount_with_bank(msg, context);
+            break;
+        case SCREEN_VAULT_NAME:
+            set_vault_name(msg, context);
+            break;
+        case SCREEN_BANK_NAME:
+            set_bank_name(msg, context);
+            break;
+        case SCREEN_PICKLE_VAULT_NAME:
+            set_pickle_vault_name(msg);
+            break;
+        case SCREEN_VAULT_ADDRESS:
+            set_vault_ui(msg, context);
+            break;
+        case SCREEN_RECIPIENT:
+            set_recipient_ui(msg, context);
+            break;
+        case SCREEN_OWNER:
+            set_owner_ui(msg, context);
+            break;
+        case SCREEN_SLIPPAGE:
+            set_slippage_ui(msg, context);
             break;
-        case IB_MINT:
-        case IB_REDEEM:
-        case IB_REDEEM_UNDERLYING:
-        case IB_BORROW:
-        case IB_REPAY_BORROW:
-            handle_query_contract_ui_ironbank(msg, context);
+        case SCREEN_BATCH_CALL:
+            // The n-th SCREEN_BATCH_CALL of the flow, which comes first, shows call n.
+            set_batch_call_ui(msg, context, position);
             break;
         default:
-            handle_query_contract_ui_vaults(msg, context);
+            PRINTF("Received an invalid screenIndex\n");
+            msg->result = ETH_PLUGIN_RESULT_ERROR;
             return;
     }
 }
@@ -0,0 +1,223 @@
+#include "yearn_plugin.h"
+
+// Parser of multicall(bytes[] calls), fed one calldata word at a time by
+// `handle_provide_parameter`. After the selector come:
+//
+//   0x20                      offset of the bytes[]           BATCH_ARRAY_OFFSET
+//   n                         number of calls                 BATCH_COUNT
+//   n offsets                 of each call in the bytes[]     BATCH_OFFSETS
+//   then for each call:
+//     length                  4 + 32 * words                  BATCH_LENGTH
+//     selector | word 0 [0, 28)                               BATCH_SELECTOR
+//     word i [28, 32) | word i + 1 [0, 28) ...                BATCH_WORDS
+//     word n - 1 [28, 32) | zero padding
+//
+// The words of a call are shifted by its selector, so each of them is split over two calldata
+// words: the first 28 bytes are stored in place in their context_t field, the last 4 when the next
+// calldata word comes. Nothing else is buffered. Every call must be a FLOW_BATCHABLE selector on a
+// known vault of the chain and have the same recipient, the encoding must be the canonical one
+// (offsets are checked when their call is reached): anything else is refused, and the transaction
+// is blind-signed.
+
+// Bytes of a call word in the calldata word that starts with it.
+#define HEAD_LENGTH (PARAMETER_LENGTH - SELECTOR_SIZE)
+
+// Reads a uint256 that must fit in 16 bits, as offsets and lengths of a multicall do.
+static bool read_uint16(const uint8_t *word, uint16_t *value) {
+    for (uint8_t i = 0; i < PARAMETER_LENGTH - sizeof(*value); i++) {
+        if (word[i] != 0) {
+            return false;
+        }
+    }
+    *value = word[PARAMETER_LENGTH - 2] << 8 | word[PARAMETER_LENGTH - 1];
+    return true;
+}
+
+// Copies `len` bytes to `field`. The recipient of every call after the first one is compared with
+// the first call's instead: a multicall displays a single recipient.
+static bool store(context_t *context, uint8_t *field, const uint8_t *src, size_t len) {
+    if (context->batch_call > 0 && field >= context->extra_address &&
+        field < context->extra_address + ADDRESS_LENGTH) {
+        return memcmp(field, src, len) == 0;
+    }
+    memcpy(field, src, len);
+    return true;
+}
+
+// Stores the first HEAD_LENGTH bytes of word `batch_param` of the current call.
+static bool store_head(context_t *context, const param_slot_t *slot, const uint8_t *head) {
+    uint8_t *field = (uint8_t *) context + slot->field;
+
+    switch (slot->kind) {
+        case PARAM_UINT256:
+            return store(context, field, head, HEAD_LENGTH);
+        case PARAM_ADDRESS:
+            for (uint8_t i = 0; i < PARAMETER_LENGTH - ADDRESS_LENGTH; i++) {
+                if (head[i] != 0) {
+                    return false;
+                }
+            }
+            return store(context,
+                         field,
+                         head + PARAMETER_LENGTH - ADDRESS_LENGTH,
+                         ADDRESS_LENGTH - SELECTOR_SIZE);
+        case PARAM_SKIP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Stores the last SELECTOR_SIZE bytes of word `batch_param` of the current call.
+static bool store_tail(context_t *context, const param_slot_t *slot, const uint8_t *tail) {
+    uint8_t *field = (uint8_t *) context + slot->field;
+
+    switch (slot->kind) {
+        case PARAM_UINT256:
+            return store(context, field + HEAD_LENGTH, tail, SELECTOR_SIZE);
+        case PARAM_ADDRESS:
+            return store(context, field + ADDRESS_LENGTH - SELECTOR_SIZE, tail, SELECTOR_SIZE);
+        default:
+            return true;
+    }
+}
+
+static const param_slot_t *get_slot(const context_t *context) {
+    uint8_t selector = context->calls[context->batch_call].selectorIndex;
+    return (const param_slot_t *) PIC(&PARAMETER_SCHEMAS[selector][context->batch_param]);
+}
+
+// Starts the call whose selector is at the beginning of `word`.
+static bool start_call(context_t *context, const uint8_t *word) {
+    batch_call_t *call = &context->calls[context->batch_call];
+    uint8_t words = 0;
+
+    call->selectorIndex = find_selector_index(word);
+    if (call->selectorIndex >= NUM_SELECTORS ||
+        !(((const flow_t *) PIC(&FLOWS[call->selectorIndex]))->flags & FLOW_BATCHABLE)) {
+        PRINTF("Call %d: selector not supported\n", context->batch_call);
+        return false;
+    }
+    const param_slot_t *schema =
+        (const param_slot_t *) PIC(PARAMETER_SCHEMAS[call->selectorIndex]);
+    while (words < MAX_PARAMS && schema[words].kind != PARAM_END) {
+        words++;
+    }
+    if (words != context->batch_words) {
+        PRINTF("Call %d: %d words, expected %d\n",
+               context->batch_call,
+               context->batch_words,
+               words);
+        return false;
+    }
+    context->batch_param = 0;
+    return store_head(context, get_slot(context), word + SELECTOR_SIZE);
+}
+
+// Keeps what the screen of the current call displays, once all its words are stored.
+static bool end_call(context_t *context) {
+    batch_call_t *call = &context->calls[context->batch_call];
+    const chain_t *chain = (const chain_t *) PIC(&CHAINS[context->chain_index]);
+
+    for (uint8_t i = 0; i < INT256_LENGTH - BATCH_AMOUNT_LENGTH; i++) {
+        if (context->amount[i] != 0) {
+            PRINTF("Call %d: amount too large\n", context->batch_call);
+            return false;
+        }
+    }
+    memcpy(call->amount,
+           context->amount + INT256_LENGTH - BATCH_AMOUNT_LENGTH,
+           BATCH_AMOUNT_LENGTH);
+    call->vault_index =
+        find_vault(context->chain_index, chain->chain_id, false, context->vault_address);
+    if (call->vault_index == VAULT_NOT_FOUND) {
+        PRINTF("Call %d: unknown vault\n", context->batch_call);
+        return false;
+    }
+    context->batch_call++;
+    context->batch_state =
+        context->batch_call == context->batch_count ? BATCH_DONE : BATCH_LENGTH;
+    return true;
+}
+
+// Returns the chain whose vaults the calls are looked up in. Legacy transactions only give their
+// chain ID after the data: the first chain is assumed, and `handle_finalize` checks it.
+uint8_t get_batch_chain_index(const txContent_t *content) {
+    if (content->chainID.length == 0) {
+        return 0;
+    }
+    return find_chain_index(get_chain_id(content));
+}
+
+static bool parse_word(context_t *context, const uint8_t *word, const txContent_t *content) {
+    uint16_t value;
+
+    switch (context->batch_state) {
+        case BATCH_ARRAY_OFFSET:
+            context->chain_index = get_batch_chain_index(content);
+            context->batch_state = BATCH_COUNT;
+            return context->chain_index != CHAIN_NOT_FOUND && read_uint16(word, &value) &&
+                   value == PARAMETER_LENGTH;
+        case BATCH_COUNT:
+            if (!read_uint16(word, &value) || value == 0 || value > MAX_BATCH_CALLS) {
+                PRINTF("Unsupported number of calls\n");
+                return false;
+            }
+            context->batch_count = value;
+            context->batch_state = BATCH_OFFSETS;
+            return true;
+        case BATCH_OFFSETS:
+            if (!read_uint16(word, &context->calls[context->batch_call].offset)) {
+                return false;
+            }
+            context->offset += PARAMETER_LENGTH;
+            if (++context->batch_call == context->batch_count) {
+                context->batch_call = 0;
+                context->batch_state = BATCH_LENGTH;
+            }
+            return true;
+        case BATCH_LENGTH:
+            if (context->calls[context->batch_call].offset != context->offset ||
+                !read_uint16(word, &value) || value < SELECTOR_SIZE ||
+                (value - SELECTOR_SIZE) % PARAMETER_LENGTH != 0 ||
+                (value - SELECTOR_SIZE) / PARAMETER_LENGTH > MAX_PARAMS) {
+                PRINTF("Call %d: unexpected offset or length\n", context->batch_call);
+                return false;
+            }
+            context->batch_words = (value - SELECTOR_SIZE) / PARAMETER_LENGTH;
+            context->offset += PARAMETER_LENGTH;
+            context->batch_state = BATCH_SELECTOR;
+            return true;
+        case BATCH_SELECTOR:
+            context->offset += PARAMETER_LENGTH;
+            context->batch_state = BATCH_WORDS;
+            return start_call(context, word);
+        case BATCH_WORDS:
+            context->offset += PARAMETER_LENGTH;
+            if (!store_tail(context, get_slot(context), word)) {
+                return false;
+            }
+            if (++context->batch_param < context->batch_words) {
+                return store_head(context, get_slot(context), word + SELECTOR_SIZE);
+            }
+            for (uint8_t i = SELECTOR_SIZE; i < PARAMETER_LENGTH; i++) {
+                if (word[i] != 0) {
+                    return false;
+                }
+            }
+            return end_call(context);
+        default:
+            PRINTF("Unexpected word after the calls\n");
+            return false;
+    }
+}
+
+// Parses the next calldata word of a multicall. Returns false if the transaction is refused; the
+// parser then stays in BATCH_ERROR.
+bool parse_batch_word(context_t *context, const uint8_t *word, const txContent_t *content) {
+    if (!parse_word(context, word, content)) {
+        context->batch_state = BATCH_ERROR;
+        return false;
+    }
+    return true;
+}
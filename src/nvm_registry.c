@@ -0,0 +1,360 @@
+#include "yearn_plugin.h"
+
+#ifdef HAVE_NVM_REGISTRY
+
+#include "registry_key.h"
+
+// Registry update, loaded in the staging bank of N_registry by INS_LOAD_REGISTRY chunks in any
+// size, then committed by INS_COMMIT_REGISTRY with its signature (tools/sign_registry.py builds
+// both). All integers are big-endian:
+//
+//   "YRNR" version sequence[4] chainId[8] yearn_vaults_count iron_bank_count pool_size[2]
+//   entries, vaults then markets, each sorted by address:
+//     address[20] want[2] vault[2] vault_prefix decimals checksum[5]
+//   pool of length-prefixed tickers, `want` and `vault` are offsets in it
+//
+// Entries and the pool are written to NVM as they come, only the SHA-256 of the update and the
+// entry being received are kept in RAM. The registry in use stays in its bank until a commit
+// verifies the signature and the entries of the update: only then does the staging bank become
+// the active one. A rejected, unsigned or incomplete update leaves the registry as it was.
+
+#define REGISTRY_MAGIC   "YRNR"
+#define REGISTRY_VERSION 1
+#define HEADER_LENGTH    21
+#define ENTRY_LENGTH     (ADDRESS_LENGTH + 2 + 2 + 1 + 1 + ADDRESS_CHECKSUM_LENGTH)
+_Static_assert(ENTRY_LENGTH >= HEADER_LENGTH, "The header is received in the entry buffer.");
+
+// Update being loaded. Entries are received in `buffer`, the pool is written to NVM directly.
+typedef struct loader_t {
+    cx_sha256_t hash;
+    uint8_t buffer[ENTRY_LENGTH];  // Header, then the entry being received.
+    uint16_t received;             // Bytes of the update received, 0 if none is being loaded.
+    uint16_t entries_end;          // Offset of the pool in the update.
+    uint16_t length;               // Of the whole update.
+    uint32_t sequence;
+    uint64_t chain_id;
+    uint8_t yearn_vaults_count;
+    uint8_t iron_bank_count;
+} loader_t;
+
+static loader_t loader;
+
+static uint64_t read_be(const uint8_t *data, uint8_t len) {
+    uint64_t value = 0;
+
+    for (uint8_t i = 0; i < len; i++) {
+        value = value << 8 | data[i];
+    }
+    return value;
+}
+
+// Bank of the registry in use.
+static volatile nvm_registry_bank_t *get_active_bank(void) {
+    return &N_registry.banks[N_registry.active & 1];
+}
+
+// Bank an update is loaded in.
+static volatile nvm_registry_bank_t *get_staging_bank(void) {
+    return &N_registry.banks[(N_registry.active & 1) ^ 1];
+}
+
+static const yearnVaultDefinition_t *get_nvm_table(bool iron_bank) {
+    volatile nvm_registry_bank_t *bank = get_active_bank();
+    const yearnVaultDefinition_t *vaults = (const yearnVaultDefinition_t *) bank->vaults;
+    return iron_bank ? vaults + bank->yearn_vaults_count : vaults;
+}
+
+static uint8_t get_nvm_table_count(bool iron_bank) {
+    volatile nvm_registry_bank_t *bank = get_active_bank();
+    return iron_bank ? bank->iron_bank_count : bank->yearn_vaults_count;
+}
+
+// Returns the index of `address` in the Yearn vaults (or the Iron Bank markets) of the NVM
+// registry, if it is valid and for `chain_id`, or VAULT_NOT_FOUND.
+uint8_t find_nvm_vault_index(uint64_t chain_id, bool iron_bank, const uint8_t *address) {
+    volatile nvm_registry_bank_t *bank = get_active_bank();
+    if (bank->valid != NVM_REGISTRY_VALID || bank->chain_id != chain_id) {
+        return VAULT_NOT_FOUND;
+    }
+    return find_vault_index(get_nvm_table(iron_bank), get_nvm_table_count(iron_bank), address);
+}
+
+// Returns the entry `index` of `find_nvm_vault_index`, or NULL if the registry changed since.
+const yearnVaultDefinition_t *get_nvm_vault_definition(bool iron_bank, uint8_t index) {
+    if (get_active_bank()->valid != NVM_REGISTRY_VALID || index >= get_nvm_table_count(iron_bank)) {
+        return NULL;
+    }
+    return get_nvm_table(iron_bank) + index;
+}
+
+// Returns whether `address` is a vault or market of the NVM registry, whatever its chain: see
+// `is_known_destination`.
+bool is_nvm_destination(const uint8_t *address) {
+    uint64_t chain_id = get_active_bank()->chain_id;
+    return find_nvm_vault_index(chain_id, false, address) != VAULT_NOT_FOUND ||
+           find_nvm_vault_index(chain_id, true, address) != VAULT_NOT_FOUND;
+}
+
+// Returns the pool of the NVM registry: ticker offsets past TICKER_POOL point in it.
+const char *get_nvm_pool(void) {
+    return (const char *) get_active_bank()->pool;
+}
+
+// Reads the header in `loader.buffer`. An update that is not newer than the registry in use is
+// refused before anything is written. Only the staging bank is invalidated, the registry in use
+// remains valid until the update is committed.
+static uint16_t parse_header(void) {
+    const uint8_t *header = loader.buffer;
+    volatile nvm_registry_bank_t *staging = get_staging_bank();
+    uint8_t valid = 0;
+
+    if (memcmp(header, REGISTRY_MAGIC, 4) != 0 || header[4] != REGISTRY_VERSION) {
+        return SW_WRONG_DATA;
+    }
+    loader.sequence = read_be(header + 5, 4);
+    loader.chain_id = read_be(header + 9, 8);
+    loader.yearn_vaults_count = header[17];
+    loader.iron_bank_count = header[18];
+    uint32_t sequence = get_active_bank()->sequence;
+    if (loader.sequence <= sequence) {
+        PRINTF("Registry update %d is not newer than %d\n", loader.sequence, sequence);
+        return SW_CONDITIONS_NOT_SATISFIED;
+    }
+    uint16_t pool_size = read_be(header + 19, 2);
+    if (loader.chain_id == 0 ||
+        loader.yearn_vaults_count + loader.iron_bank_count > NVM_REGISTRY_MAX_VAULTS ||
+        pool_size > NVM_REGISTRY_POOL_SIZE) {
+        return SW_WRONG_DATA;
+    }
+    loader.entries_end =
+        HEADER_LENGTH + (loader.yearn_vaults_count + loader.iron_bank_count) * ENTRY_LENGTH;
+    loader.length = loader.entries_end + pool_size;
+    nvm_write((void *) &staging->valid, &valid, sizeof(valid));
+    return SW_OK;
+}
+
+// Writes the entry in `loader.buffer` to the vault `index` of the staging bank.
+static void write_entry(uint8_t index) {
+    const uint8_t *entry = loader.buffer;
+    yearnVaultDefinition_t vault;
+
+    memcpy(vault.address, entry, ADDRESS_LENGTH);
+    vault.want = TICKER_POOL_SIZE + read_be(entry + 20, 2);
+    vault.vault = TICKER_POOL_SIZE + read_be(entry + 22, 2);
+    vault.vault_prefix = entry[24];
+    vault.decimals = entry[25];
+    memcpy(vault.checksum, entry + 26, ADDRESS_CHECKSUM_LENGTH);
+    nvm_write((void *) &get_staging_bank()->vaults[index], &vault, sizeof(vault));
+}
+
+static uint16_t load_chunk(const uint8_t *data, uint8_t len) {
+    cx_hash(&loader.hash.header, 0, data, len, NULL, 0);
+    while (len > 0) {
+        uint16_t end;
+        uint8_t *buffer = loader.buffer;
+
+        if (loader.received < HEADER_LENGTH) {
+            end = HEADER_LENGTH;
+            buffer += loader.received;
+        } else if (loader.received < loader.entries_end) {
+            uint8_t offset = (loader.received - HEADER_LENGTH) % ENTRY_LENGTH;
+            end = loader.received - offset + ENTRY_LENGTH;
+            buffer += offset;
+        } else if (loader.received < loader.length) {
+            end = loader.length;
+            buffer = NULL;
+        } else {
+            PRINTF("Registry update longer than its header says\n");
+            return SW_WRONG_DATA;
+        }
+
+        uint16_t size = end - loader.received < len ? end - loader.received : len;
+        if (buffer != NULL) {
+            memcpy(buffer, data, size);
+        } else {
+            nvm_write((void *) &get_staging_bank()->pool[loader.received - loader.entries_end],
+                      (void *) data,
+                      size);
+        }
+        loader.received += size;
+        data += size;
+        len -= size;
+
+        if (loader.received == HEADER_LENGTH) {
+            uint16_t sw = parse_header();
+            if (sw != SW_OK) {
+                return sw;
+            }
+        } else if (buffer != NULL && loader.received == end) {
+            write_entry((end - HEADER_LENGTH) / ENTRY_LENGTH - 1);
+        }
+    }
+    return SW_OK;
+}
+
+// Returns whether the ticker at `offset` (a `yearnVaultDefinition_t` offset) is in the pool of the
+// staging bank.
+static bool check_ticker(uint16_t offset, uint16_t pool_size) {
+    offset -= TICKER_POOL_SIZE;
+    if (offset >= pool_size) {
+        return false;
+    }
+    uint8_t len = get_staging_bank()->pool[offset];
+    return len > 0 && len < MAX_VAULT_TICKER_LEN && offset + 1 + len <= pool_size;
+}
+
+// Checks the `count` entries of the update in the staging bank from `first`: sorted by address for
+// the binary search, no vault prefix and tickers in the pool.
+static bool check_table(uint8_t first, uint8_t count, uint16_t pool_size) {
+    const yearnVaultDefinition_t *vaults =
+        (const yearnVaultDefinition_t *) get_staging_bank()->vaults;
+
+    for (uint8_t i = first; i < first + count; i++) {
+        if ((i > first &&
+             memcmp(vaults[i - 1].address, vaults[i].address, ADDRESS_LENGTH) >= 0) ||
+            vaults[i].vault_prefix != 0 || !check_ticker(vaults[i].want, pool_size) ||
+            !check_ticker(vaults[i].vault, pool_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Verifies the update loaded in the staging bank and makes it the registry in use.
+static uint16_t commit(const uint8_t *signature, uint8_t len) {
+    uint8_t digest[CX_SHA256_SIZE];
+    cx_ecfp_public_key_t key;
+    uint8_t valid = NVM_REGISTRY_VALID;
+    volatile nvm_registry_bank_t *staging = get_staging_bank();
+    uint8_t active = (N_registry.active & 1) ^ 1;
+
+    if (loader.received < HEADER_LENGTH || loader.received != loader.length) {
+        PRINTF("Registry update incomplete\n");
+        return SW_CONDITIONS_NOT_SATISFIED;
+    }
+    // Whatever the outcome, the update must be loaded again.
+    loader.received = 0;
+    cx_hash(&loader.hash.header, CX_LAST, NULL, 0, digest, sizeof(digest));
+    cx_ecfp_init_public_key(CX_CURVE_256K1,
+                            REGISTRY_PUBLIC_KEY,
+                            sizeof(REGISTRY_PUBLIC_KEY),
+                            &key);
+    if (!cx_ecdsa_verify(&key, CX_LAST, CX_SHA256, digest, sizeof(digest), signature, len)) {
+        PRINTF("Registry update: wrong signature\n");
+        return SW_SECURITY_STATUS;
+    }
+    uint16_t pool_size = loader.length - loader.entries_end;
+    if (!check_table(0, loader.yearn_vaults_count, pool_size) ||
+        !check_table(loader.yearn_vaults_count, loader.iron_bank_count, pool_size)) {
+        PRINTF("Registry update: invalid entries\n");
+        return SW_WRONG_DATA;
+    }
+
+    nvm_write((void *) &staging->sequence, &loader.sequence, sizeof(loader.sequence));
+    nvm_write((void *) &staging->chain_id, &loader.chain_id, sizeof(loader.chain_id));
+    nvm_write((void *) &staging->yearn_vaults_count,
+              &loader.yearn_vaults_count,
+              sizeof(loader.yearn_vaults_count));
+    nvm_write((void *) &staging->iron_bank_count,
+              &loader.iron_bank_count,
+              sizeof(loader.iron_bank_count));
+    nvm_write((void *) &staging->valid, &valid, sizeof(valid));
+    // A single byte: the registry in use is either the old one or the new one.
+    nvm_write((void *) &N_registry.active, &active, sizeof(active));
+    return SW_OK;
+}
+
+static void write_be(uint8_t *out, uint64_t value, uint8_t len) {
+    for (uint8_t i = len; i > 0; i--) {
+        out[i - 1] = value;
+        value >>= 8;
+    }
+}
+
+// Writes `string` length-prefixed to `out`. Returns its length, prefix included.
+static size_t write_string(uint8_t *out, const char *string) {
+    size_t len = strlen(string);
+
+    out[0] = len;
+    memcpy(out + 1, string, len);
+    return 1 + len;
+}
+
+// Without data: valid, sequence[4], chainId[8], yearn_vaults_count, iron_bank_count. With a vault
+// address: decimals, want and vault name, length-prefixed.
+static uint16_t get_registry(uint8_t p1,
+                             const uint8_t *data,
+                             uint8_t len,
+                             uint8_t *out,
+                             size_t *out_len) {
+    char ticker[MAX_VAULT_TICKER_LEN];
+
+    if (len == 0) {
+        volatile nvm_registry_bank_t *bank = get_active_bank();
+        out[0] = bank->valid == NVM_REGISTRY_VALID;
+        write_be(out + 1, bank->sequence, 4);
+        write_be(out + 5, bank->chain_id, 8);
+        out[13] = bank->yearn_vaults_count;
+        out[14] = bank->iron_bank_count;
+        *out_len = 15;
+        return SW_OK;
+    }
+    if (len != ADDRESS_LENGTH) {
+        return SW_WRONG_LENGTH;
+    }
+    if (p1 > 1) {
+        return SW_WRONG_P1P2;
+    }
+    uint8_t index = find_nvm_vault_index(get_active_bank()->chain_id, p1 == 1, data);
+    const yearnVaultDefinition_t *vault = NULL;
+    if (index != VAULT_NOT_FOUND) {
+        vault = get_nvm_vault_definition(p1 == 1, index);
+    }
+    if (vault == NULL) {
+        return SW_NOT_FOUND;
+    }
+    out[0] = vault->decimals;
+    *out_len = 1;
+    copy_vault_want(vault, ticker, sizeof(ticker));
+    *out_len += write_string(out + *out_len, ticker);
+    copy_vault_name_string(vault, ticker, sizeof(ticker));
+    *out_len += write_string(out + *out_len, ticker);
+    return SW_OK;
+}
+
+// Handles the registry APDU `ins` (CLA REGISTRY_CLA), see INS_*_REGISTRY. Its response data is
+// written to `out`, which must hold 64 bytes, and its length to `out_len`. Returns the status word.
+uint16_t handle_registry_apdu(uint8_t ins,
+                              uint8_t p1,
+                              const uint8_t *data,
+                              uint8_t data_len,
+                              uint8_t *out,
+                              size_t *out_len) {
+    uint16_t sw;
+
+    *out_len = 0;
+    switch (ins) {
+        case INS_LOAD_REGISTRY:
+            if (p1 == P1_FIRST_CHUNK) {
+                memset(&loader, 0, sizeof(loader));
+                cx_sha256_init(&loader.hash);
+            } else if (p1 != P1_NEXT_CHUNK) {
+                return SW_WRONG_P1P2;
+            } else if (loader.received == 0) {
+                return SW_CONDITIONS_NOT_SATISFIED;
+            }
+            sw = load_chunk(data, data_len);
+            if (sw != SW_OK) {
+                loader.received = 0;
+            }
+            return sw;
+        case INS_COMMIT_REGISTRY:
+            return commit(data, data_len);
+        case INS_GET_REGISTRY:
+            return get_registry(p1, data, data_len, out, out_len);
+        default:
+            return SW_INS_NOT_SUPPORTED;
+    }
+}
+
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+
+// Uncompressed secp256k1 public key that NVM registry updates must be signed with, see
+// tools/sign_registry.py --public-key. Only the test key exists: the NVM registry cannot be built
+// for release until a release key is added here.
+#ifdef HAVE_REGISTRY_TEST_KEY
+// tests/registry/test_key.hex: for Speculos and the host tests only, its private key is public.
+static const uint8_t REGISTRY_PUBLIC_KEY[65] = {
+    0x04, 0x14, 0x6e, 0xee, 0xde, 0x94, 0xee, 0xdf, 0x35, 0xa6, 0xa0, 0xec, 0x56,
+    0xa1, 0x37, 0x15, 0xb2, 0x2f, 0x51, 0x79, 0xf9, 0xba, 0x0a, 0xa1, 0x21, 0x20,
+    0x0a, 0x40, 0x67, 0x78, 0x00, 0x5a, 0x48, 0x30, 0x65, 0x10, 0x61, 0x9c, 0xf0,
+    0x5a, 0x65, 0xef, 0x1f, 0xd0, 0x10, 0x34, 0xb0, 0x40, 0x6a, 0x36, 0x19, 0x47,
+    0xd8, 0x8f, 0x46, 0xaf, 0xf1, 0xde, 0x14, 0x83, 0x0f, 0x5d, 0xf9, 0x5a, 0x88,
+};
+#else
+#error "The NVM registry is test-only, it has no release key: build it with REGISTRY_TEST_KEY=1."
+#endif
@@ -0,0 +1,77 @@
+// Generated by tools/gen_registry.py from registry/yearn.json, do not edit.
+// Perfect hash over YEARN_SELECTORS: a selector read as a big-endian uint32_t lands in
+// slot (selector * SELECTOR_HASH_MULTIPLIER) >> (32 - SELECTOR_HASH_BITS).
+#pragma once
+
+#include "yearn_plugin.h"
+
+#define SELECTOR_HASH_MULTIPLIER 0x90F92DA9u
+#define SELECTOR_HASH_BITS       6
+#define SELECTOR_NOT_FOUND       0xFF
+
+static const uint8_t SELECTOR_HASH_TABLE[1 << SELECTOR_HASH_BITS] = {
+    IB_REDEEM,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    WITHDRAW_ALL,
+    ROUTER_DEPOSIT,
+    SELECTOR_NOT_FOUND,
+    ERC4626_WITHDRAW,
+    DEPOSIT_ALL,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    WITHDRAW_TO,
+    SELECTOR_NOT_FOUND,
+    IB_REPAY_BORROW,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    ROUTER_WITHDRAW,
+    WITHDRAW,
+    DEPOSIT_TO,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    CLAIM,
+    IB_REDEEM_UNDERLYING,
+    IB_BORROW,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    EXIT,
+    SELECTOR_NOT_FOUND,
+    ROUTER_REDEEM,
+    IB_MINT,
+    MULTICALL,
+    ERC4626_REDEEM,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    ZAP_IN,
+    ZAP_IN_PICKLE,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    WITHDRAW_TO_SLIPPAGE,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    DEPOSIT_ALL_YVECRV,
+    SELECTOR_NOT_FOUND,
+    GET_REWARDS,
+    SELECTOR_NOT_FOUND,
+    DEPOSIT,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    ROUTER_MINT,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+    ERC4626_MINT,
+    SELECTOR_NOT_FOUND,
+    SELECTOR_NOT_FOUND,
+};
@@ -0,0 +1,220 @@
+#include "yearn_plugin.h"
+
+// Binary search for `address` in `table`, an array of `count` entries of `entry_size` bytes that
+// start with their address and are sorted by it (tools/gen_registry.py emits the tables in that
+// order). Returns the index of the matching entry, or VAULT_NOT_FOUND.
+static uint8_t find_address_index(const void *table,
+                                  size_t entry_size,
+                                  uint8_t count,
+                                  const uint8_t *address) {
+    const uint8_t *entries = (const uint8_t *) PIC(table);
+    uint8_t low = 0;
+    uint8_t high = count;
+
+    while (low < high) {
+        uint8_t mid = low + (high - low) / 2;
+        int cmp = memcmp(entries + mid * entry_size, address, ADDRESS_LENGTH);
+        if (cmp == 0) {
+            return mid;
+        }
+        if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return VAULT_NOT_FOUND;
+}
+
+// Returns the index of `address` in `vaults`, or VAULT_NOT_FOUND.
+uint8_t find_vault_index(const yearnVaultDefinition_t *vaults,
+                         uint8_t vaults_count,
+                         const uint8_t *address) {
+    return find_address_index(vaults, sizeof(*vaults), vaults_count, address);
+}
+
+// Returns the `vault_index` of `address` in the Yearn vaults (or the Iron Bank markets) of chain
+// `chain_index`, which may be CHAIN_NOT_FOUND, then in the NVM registry of `chain_id`. Returns
+// VAULT_NOT_FOUND if it is in neither.
+uint8_t find_vault(uint8_t chain_index, uint64_t chain_id, bool iron_bank, const uint8_t *address) {
+    uint8_t index = VAULT_NOT_FOUND;
+
+    if (chain_index < NUM_CHAINS) {
+        const chain_t *chain = (const chain_t *) PIC(&CHAINS[chain_index]);
+        if (iron_bank) {
+            index = find_vault_index(chain->iron_bank, chain->iron_bank_count, address);
+        } else {
+            index = find_vault_index(chain->yearn_vaults, chain->yearn_vaults_count, address);
+        }
+    }
+#ifdef HAVE_NVM_REGISTRY
+    if (index == VAULT_NOT_FOUND) {
+        index = find_nvm_vault_index(chain_id, iron_bank, address);
+        if (index != VAULT_NOT_FOUND) {
+            index |= VAULT_NVM;
+        }
+    }
+#else
+    (void) chain_id;
+#endif
+    return index;
+}
+
+// Returns the entry `vault_index` of the Yearn vaults (or the Iron Bank markets) of chain
+// `chain_index`, see `find_vault`.
+static const yearnVaultDefinition_t *get_table_entry(uint8_t chain_index,
+                                                     bool iron_bank,
+                                                     uint8_t vault_index) {
+#ifdef HAVE_NVM_REGISTRY
+    if (vault_index & VAULT_NVM) {
+        return get_nvm_vault_definition(iron_bank, vault_index & ~VAULT_NVM);
+    }
+#endif
+    if (chain_index >= NUM_CHAINS) {
+        return NULL;
+    }
+    const chain_t *chain = (const chain_t *) PIC(&CHAINS[chain_index]);
+    const yearnVaultDefinition_t *table = iron_bank ? chain->iron_bank : chain->yearn_vaults;
+    return (const yearnVaultDefinition_t *) PIC(&table[vault_index]);
+}
+
+// Returns whether the first 4 bytes of `address` are those of a contract of the registry, on any
+// chain: the chain ID is not always known at init. Unknown destinations are refused before any
+// parameter is parsed. A false positive is harmless, vaults are still looked up exactly.
+bool is_known_destination(const uint8_t *address) {
+    const uint32_t *fingerprints = (const uint32_t *) PIC(DESTINATION_FINGERPRINTS);
+    uint32_t fingerprint = ((uint32_t) address[0] << 24) | ((uint32_t) address[1] << 16) |
+                           ((uint32_t) address[2] << 8) | (uint32_t) address[3];
+    uint16_t low = 0;
+    uint16_t high = NUM_DESTINATIONS;
+
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (fingerprints[mid] == fingerprint) {
+            return true;
+        }
+        if (fingerprints[mid] < fingerprint) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+#ifdef HAVE_NVM_REGISTRY
+    return is_nvm_destination(address);
+#else
+    return false;
+#endif
+}
+
+// Returns the chain ID of the transaction, or 0 if it does not fit in 64 bits.
+uint64_t get_chain_id(const txContent_t *content) {
+    uint64_t chain_id = 0;
+
+    if (content->chainID.length > sizeof(chain_id)) {
+        return 0;
+    }
+    for (uint8_t i = 0; i < content->chainID.length; i++) {
+        chain_id = chain_id << 8 | content->chainID.value[i];
+    }
+    return chain_id;
+}
+
+// Returns the index in CHAINS of `chain_id`, or CHAIN_NOT_FOUND. There are only a few chains.
+uint8_t find_chain_index(uint64_t chain_id) {
+    const chain_t *chains = (const chain_t *) PIC(CHAINS);
+
+    for (uint8_t i = 0; i < NUM_CHAINS; i++) {
+        if (chains[i].chain_id == chain_id) {
+            return i;
+        }
+    }
+    return CHAIN_NOT_FOUND;
+}
+
+// Returns what is displayed for the selector of this transaction.
+const flow_t *get_flow(const context_t *context) {
+    return (const flow_t *) PIC(&FLOWS[context->selectorIndex]);
+}
+
+// Returns the table entry resolved by `handle_finalize` for this transaction, or NULL if the
+// destination is not a known vault / Iron Bank market of the transaction's chain.
+const yearnVaultDefinition_t *get_vault_definition(const context_t *context) {
+    if (context->vault_index == VAULT_NOT_FOUND) {
+        return NULL;
+    }
+    return get_table_entry(context->chain_index,
+                           get_flow(context)->flags & FLOW_IRON_BANK,
+                           context->vault_index);
+}
+
+// Returns the vault of call `call` of a multicall, checked by `parse_batch_word`.
+const yearnVaultDefinition_t *get_batch_vault_definition(const context_t *context, uint8_t call) {
+    return get_table_entry(context->chain_index, false, context->calls[call].vault_index);
+}
+
+// Returns the embedded entry of the token sent by a zap, in `extra_address`, or NULL if it is not
+// a common zap input of the transaction's chain.
+const zapTokenDefinition_t *get_zap_token(const context_t *context) {
+    if (context->chain_index >= NUM_CHAINS) {
+        return NULL;
+    }
+    const chain_t *chain = (const chain_t *) PIC(&CHAINS[context->chain_index]);
+    uint8_t index = find_address_index(chain->zap_tokens,
+                                       sizeof(zapTokenDefinition_t),
+                                       chain->zap_tokens_count,
+                                       context->extra_address);
+    if (index == VAULT_NOT_FOUND) {
+        return NULL;
+    }
+    return (const zapTokenDefinition_t *) PIC(chain->zap_tokens) + index;
+}
+
+// Appends the length-prefixed string at `offset` in TICKER_POOL to `out`, which already holds
+// `len` characters. Returns the new length; `out` is always NUL-terminated. Offsets past
+// TICKER_POOL are in the pool of the NVM registry.
+static size_t append_pool_string(uint16_t offset, char *out, size_t len, size_t out_size) {
+    const char *pool = (const char *) PIC(TICKER_POOL);
+#ifdef HAVE_NVM_REGISTRY
+    if (offset >= TICKER_POOL_SIZE) {
+        pool = get_nvm_pool();
+        offset -= TICKER_POOL_SIZE;
+    }
+#endif
+    size_t string_len = (uint8_t) pool[offset];
+
+    if (len + string_len >= out_size) {
+        string_len = out_size - 1 - len;
+    }
+    memcpy(out + len, pool + offset + 1, string_len);
+    out[len + string_len] = '\0';
+    return len + string_len;
+}
+
+// Copies the want ticker of `vault` (e.g. "stETH") to `out`.
+void copy_vault_want(const yearnVaultDefinition_t *vault, char *out, size_t out_size) {
+    append_pool_string(vault->want, out, 0, out_size);
+}
+
+// Copies the full name of `vault`, its prefix followed by the pooled suffix (e.g. "yvCurve-" +
+// "stETH"), to `out`.
+void copy_vault_name_string(const yearnVaultDefinition_t *vault, char *out, size_t out_size) {
+    const uint16_t *prefixes = (const uint16_t *) PIC(VAULT_PREFIXES);
+    size_t len = append_pool_string(prefixes[vault->vault_prefix], out, 0, out_size);
+    append_pool_string(vault->vault, out, len, out_size);
+}
+
+// Copies the ticker of `token` (e.g. "USDC") to `out`.
+void copy_zap_token_ticker(const zapTokenDefinition_t *token, char *out, size_t out_size) {
+    append_pool_string(token->ticker, out, 0, out_size);
+}
+
+// Copies the ticker of the coin of the chain at `chain_index` (e.g. "FTM") to `out`, "???" on a
+// chain missing from CHAINS.
+void copy_native_ticker(uint8_t chain_index, char *out, size_t out_size) {
+    if (chain_index >= NUM_CHAINS) {
+        strlcpy(out, "???", out_size);
+        return;
+    }
+    const chain_t *chain = (const chain_t *) PIC(&CHAINS[chain_index]);
+    append_pool_string(chain->native_ticker, out, 0, out_size);
+}
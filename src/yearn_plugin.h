@@ -2,83 +2,322 @@
 
 #include "eth_internals.h"
 #include "eth_plugin_interface.h"
+#include <stddef.h>
 #include <string.h>
 
+// Selector enum and table sizes, generated from registry/yearn.json.
+#include "yearn_registry.h"
+
 #define PLUGIN_NAME          "Yearn"
-#define NUM_SELECTORS        17
 #define MAX_VAULT_TICKER_LEN 18  // 17 characters + '\0'
 
-// Enumeration of the different selectors possible.
-// Should follow the exact same order as the array declared in main.c
+// Kind of a calldata word, see PARAMETER_SCHEMAS.
 typedef enum {
-    DEPOSIT_ALL,
-    DEPOSIT,
-    DEPOSIT_TO,
-    WITHDRAW_ALL,
-    WITHDRAW,
-    WITHDRAW_TO,
-    WITHDRAW_TO_SLIPPAGE,
-    ZAP_IN,
-    ZAP_IN_PICKLE,
-    IB_MINT,
-    IB_REDEEM,
-    IB_REDEEM_UNDERLYING,
-    IB_BORROW,
-    IB_REPAY_BORROW,
-    CLAIM,
-    EXIT,
-    GET_REWARDS,
-} selector_t;
-
-// Enumeration used to parse the smart contract data.
+    PARAM_END = 0,  // No more word expected, any further one is an error.
+    PARAM_UINT256,  // Copied to a uint8_t[INT256_LENGTH] field.
+    PARAM_ADDRESS,  // Last 20 bytes copied to a uint8_t[ADDRESS_LENGTH] field.
+    PARAM_UINT16,   // Copied to a uint16_t field, refused if it does not fit.
+    PARAM_SKIP,     // Ignored.
+    PARAM_REST,     // Ignored, as well as all the following words.
+    PARAM_CALLS,    // multicall(bytes[]): this and all the following words, see `parse_batch_word`.
+} param_kind_t;
+
+// One calldata word of a selector: what it is and where it goes in context_t.
+typedef struct param_slot_t {
+    uint8_t kind;   // `param_kind_t`
+    uint8_t field;  // Offset of the destination in context_t.
+} param_slot_t;
+
+// Screens of a flow, rendered by `handle_query_contract_ui`.
 typedef enum {
-    ZAP_TOKEN = 0,
-    ZAP_AMOUNT = 1,
-    ZAP_TO_VAULT = 2,
-    ZAP_REST = 3,
+    SCREEN_NONE = 0,           // End of the list.
+    SCREEN_AMOUNT_ALL,         // "ALL", the whole balance.
+    SCREEN_AMOUNT_WANT,        // Amount of want token (or of the token sent, for zaps).
+    SCREEN_AMOUNT_VAULT,       // Amount of vault shares.
+    SCREEN_AMOUNT_BANK,        // Amount of Iron Bank cTokens, 8 decimals.
+    SCREEN_VAULT_NAME,         // Name of the vault.
+    SCREEN_BANK_NAME,          // Name of the Iron Bank market.
+    SCREEN_PICKLE_VAULT_NAME,  // The one vault the Pickle zap deposits to.
+    SCREEN_VAULT_ADDRESS,      // Address of the vault.
+    SCREEN_RECIPIENT,          // Address receiving the tokens.
+    SCREEN_OWNER,              // ERC-4626 withdraw and redeem: owner of the shares burnt.
+    SCREEN_SLIPPAGE,           // Maximum loss, in %.
+    SCREEN_BATCH_CALL,         // One call of a multicall, the n-th of these screens for call n.
+} screen_t;
+
+// Condition or-ed with a `screen_t` in a flow, checked in `handle_finalize`.
+#define SCREEN_IF_NOT_SENDER 0x80  // Only if the address shown is not the transaction's sender.
+#define SCREEN_MASK          0x7F
 
-    AMOUNT = 0,
-    RECIPIENT,
-    SLIPPAGE,
-    UNEXPECTED_PARAMETER,
-} parameter;
+#define FLOW_IRON_BANK           0x01  // The destination is an IRON_BANK market.
+#define FLOW_VAULT_FROM_CALLDATA 0x02  // The vault is a parameter, not the destination (zaps).
+#define FLOW_TOKEN_LOOKUP        0x04  // The token sent, in extra_address, comes in PROVIDE_INFO.
+#define FLOW_BATCH               0x08  // multicall(bytes[]): the screens show `context_t.calls`.
+#define FLOW_BATCHABLE           0x10  // May be a call of a multicall.
+
+// What is displayed for a selector: QUERY_CONTRACT_ID name and version, then the screens.
+typedef struct flow_t {
+    const char *name;
+    const char *version;
+    uint8_t flags;                 // FLOW_*
+    uint8_t screens[MAX_SCREENS];  // `screen_t` and SCREEN_IF_* conditions.
+} flow_t;
 
 extern const uint8_t *const YEARN_SELECTORS[NUM_SELECTORS];
+// Flow of each selector, generated from the "flows" of registry/yearn.json.
+extern const flow_t FLOWS[NUM_SELECTORS];
+// Calldata layout of each selector, generated from the "params" of registry/yearn.json.
+extern const param_slot_t PARAMETER_SCHEMAS[NUM_SELECTORS][MAX_PARAMS];
+
+// Case mask of a checksummed (EIP-55) address, one bit per hex character.
+#define ADDRESS_CHECKSUM_LENGTH (ADDRESS_LENGTH * 2 / 8)
 
+// Vault tables are generated sorted by address: lookups use a binary search.
+// Tickers are stored once in TICKER_POOL, see `copy_vault_want` and `copy_vault_name_string`.
 typedef struct yearnVaultDefinition_t {
     uint8_t address[ADDRESS_LENGTH];
-    char want[MAX_VAULT_TICKER_LEN];
-    char vault[MAX_VAULT_TICKER_LEN];
+    uint16_t want;         // Offset of the want ticker in TICKER_POOL.
+    uint16_t vault;        // Offset of the vault name, without its prefix, in TICKER_POOL.
+    uint8_t vault_prefix;  // `vault_prefix_t`
     uint8_t decimals;
+    uint8_t checksum[ADDRESS_CHECKSUM_LENGTH];  // EIP-55 case mask of `address`.
 } yearnVaultDefinition_t;
 
-#define NUM_YEARN_VAULTS 85
-extern yearnVaultDefinition_t const YEARN_VAULTS[NUM_YEARN_VAULTS];
-#define NUM_IRON_BANK 32
-extern yearnVaultDefinition_t const IRON_BANK[NUM_IRON_BANK];
+// Token commonly sent to zaps, displayed when the Ethereum app has no info on it, see
+// `handle_provide_token`. Tables are sorted by address too.
+typedef struct zapTokenDefinition_t {
+    uint8_t address[ADDRESS_LENGTH];
+    uint16_t ticker;  // Offset of the ticker in TICKER_POOL.
+    uint8_t decimals;
+} zapTokenDefinition_t;
+
+// Vault and zap token tables of one chain, each sorted on its own. A chain without Iron Bank has a
+// NULL table.
+typedef struct chain_t {
+    uint64_t chain_id;
+    const yearnVaultDefinition_t *yearn_vaults;
+    const yearnVaultDefinition_t *iron_bank;
+    const zapTokenDefinition_t *zap_tokens;
+    uint8_t yearn_vaults_count;
+    uint8_t iron_bank_count;
+    uint8_t zap_tokens_count;
+    uint16_t native_ticker;  // Offset in TICKER_POOL of the ticker of the chain's coin, e.g. "ETH".
+} chain_t;
+
+// Generated from the "chains" of registry/yearn.json, see `find_chain_index`.
+extern const chain_t CHAINS[NUM_CHAINS];
+extern const char TICKER_POOL[TICKER_POOL_SIZE];
+extern const uint16_t VAULT_PREFIXES[NUM_VAULT_PREFIXES];
+// First 4 bytes of every contract address, sorted, see `is_known_destination`.
+extern const uint32_t DESTINATION_FINGERPRINTS[NUM_DESTINATIONS];
+
+// Returned by `find_vault_index` when the address is not in the table.
+#define VAULT_NOT_FOUND 0xFF
+_Static_assert(MAX_TABLE_SIZE < VAULT_NOT_FOUND, "Too many vaults for a uint8_t index.");
+
+// Returned by `find_chain_index` when the transaction's chain has no tables.
+#define CHAIN_NOT_FOUND 0xFF
+_Static_assert(NUM_CHAINS < CHAIN_NOT_FOUND, "Too many chains for a uint8_t index.");
+
+#ifdef HAVE_NVM_REGISTRY
+// Vaults and Iron Bank markets of one chain added without a new build, by an update signed with
+// REGISTRY_PUBLIC_KEY (see src/nvm_registry.c and tools/sign_registry.py). Entries use the layout
+// of the built-in tables; their ticker offsets start at TICKER_POOL_SIZE, for `pool`.
+#define NVM_REGISTRY_MAX_VAULTS 64  // Both tables together.
+#define NVM_REGISTRY_POOL_SIZE  1024
+#define NVM_REGISTRY_VALID      0xA5
+
+typedef struct nvm_registry_bank_t {
+    uint8_t valid;  // NVM_REGISTRY_VALID once an update is loaded and its signature checked.
+    uint8_t yearn_vaults_count;
+    uint8_t iron_bank_count;
+    uint32_t sequence;  // Of the update loaded: only a greater one is accepted.
+    uint64_t chain_id;
+    yearnVaultDefinition_t vaults[NVM_REGISTRY_MAX_VAULTS];  // Yearn vaults, then markets.
+    char pool[NVM_REGISTRY_POOL_SIZE];
+} nvm_registry_bank_t;
+
+// An update is written to the bank that is not `active`, which only changes once the update is
+// verified: the registry in use is never touched by the APDUs of another one.
+typedef struct nvm_registry_t {
+    uint8_t active;  // Index of the bank in use.
+    nvm_registry_bank_t banks[2];
+} nvm_registry_t;
+
+extern const nvm_registry_t N_registry_real;
+#define N_registry (*(volatile nvm_registry_t *) PIC(&N_registry_real))
+
+// APDUs of `handle_registry_apdu`, received when the app is started from the dashboard.
+#define REGISTRY_CLA                0xE0
+#define INS_LOAD_REGISTRY           0x80  // P1 P1_FIRST_CHUNK or P1_NEXT_CHUNK, data: the update.
+#define INS_COMMIT_REGISTRY         0x81  // Data: DER signature of the update.
+#define INS_GET_REGISTRY            0x82  // No data, or a vault address (P1: 1 for Iron Bank).
+#define P1_FIRST_CHUNK              0x00
+#define P1_NEXT_CHUNK               0x80
+#define SW_OK                       0x9000
+#define SW_WRONG_LENGTH             0x6700
+#define SW_SECURITY_STATUS          0x6982
+#define SW_CONDITIONS_NOT_SATISFIED 0x6985
+#define SW_WRONG_DATA               0x6A80
+#define SW_NOT_FOUND                0x6A88
+#define SW_WRONG_P1P2               0x6B00
+#define SW_INS_NOT_SUPPORTED        0x6D00
+#define SW_CLA_NOT_SUPPORTED        0x6E00
+
+// Set in `vault_index` for an entry of the NVM registry, whose index is in the other bits.
+#define VAULT_NVM 0x80
+_Static_assert(MAX_TABLE_SIZE < VAULT_NVM, "Too many vaults for the VAULT_NVM bit.");
+_Static_assert(NVM_REGISTRY_MAX_VAULTS < VAULT_NOT_FOUND - VAULT_NVM, "NVM registry too large.");
+_Static_assert(TICKER_POOL_SIZE + NVM_REGISTRY_POOL_SIZE <= UINT16_MAX, "Pools too large.");
+#endif
+
+// Bits of `context_t.checksums`: the mask has been computed for that address.
+#define CHECKSUM_RECIPIENT 0x01
+#define CHECKSUM_VAULT     0x02
+#define CHECKSUM_OWNER     0x04
+
+// Calls of a multicall, each summarized on one screen.
+#define MAX_BATCH_CALLS 3
+// Low bytes of the amount of a call kept in `batch_call_t`: larger amounts are refused.
+#define BATCH_AMOUNT_LENGTH 12
+
+// Steps of the multicall parser, see `parse_batch_word`.
+typedef enum {
+    BATCH_ARRAY_OFFSET = 0,  // Offset of the bytes[], must be 0x20.
+    BATCH_COUNT,             // Number of calls.
+    BATCH_OFFSETS,           // Offset of each call in the bytes[].
+    BATCH_LENGTH,            // Length of the next call.
+    BATCH_SELECTOR,          // Selector of the call, start of its first word.
+    BATCH_WORDS,             // End of a word of the call, start of the next one or padding.
+    BATCH_DONE,              // Every call was parsed, nothing else is expected.
+    BATCH_ERROR,             // The multicall is refused.
+} batch_state_t;
+
+// One call of a multicall, only what its screen needs.
+typedef struct batch_call_t {
+    uint16_t offset;        // In the bytes[], as announced by the calldata; checked when reached.
+    uint8_t selectorIndex;  // `selector_t`, always of a FLOW_BATCHABLE flow.
+    uint8_t vault_index;    // Index in the chain's yearn_vaults.
+    uint8_t amount[BATCH_AMOUNT_LENGTH];
+} batch_call_t;
 
 // Shared global memory with Ethereum app. Must be at most 5 * 32 bytes.
+// Only what cannot be derived is stored: vault tickers are read from the tables through
+// `vault_index`, and only tokens received in PROVIDE_INFO are copied.
 typedef struct context_t {
     uint8_t amount[INT256_LENGTH];
-    uint8_t slippage[INT256_LENGTH];
     uint8_t vault_address[ADDRESS_LENGTH];
     uint8_t extra_address[ADDRESS_LENGTH];
-    char vault[MAX_VAULT_TICKER_LEN];
-    char want[MAX_VAULT_TICKER_LEN];
+    char token_ticker[MAX_TICKER_LEN];  // Zaps: ticker of the token sent, from PROVIDE_INFO.
+    // Computed on the first display of the address, so that going back to its screen does not
+    // hash it again.
+    uint8_t recipient_checksum[ADDRESS_CHECKSUM_LENGTH];  // Of extra_address.
+    uint8_t vault_checksum[ADDRESS_CHECKSUM_LENGTH];      // Of vault_address.
 
+    uint16_t slippage;  // Maximum loss in basis points, see `handle_withdraw_to_slippage`.
     uint8_t decimals;
-    uint8_t next_param;
-    uint16_t offset;
-    selector_t selectorIndex;
+    uint8_t chain_index;  // Index in CHAINS, resolved in handle_finalize.
+    uint8_t vault_index;  // Index in the chain's yearn_vaults or iron_bank, idem.
+    uint8_t checksums;    // CHECKSUM_* already computed.
+    uint8_t screens;      // Bit i: screen i of the flow is displayed, set in handle_finalize.
+    uint8_t selectorIndex : 5;  // `selector_t`
+    uint8_t next_param : 3;     // Index of the next word in PARAMETER_SCHEMAS.
+
+    union {
+        // multicall(bytes[]) only. The words of each call go through amount, vault_address and
+        // extra_address, then what is displayed is kept in `calls`.
+        batch_call_t calls[MAX_BATCH_CALLS];
+        // Zaps to a vault missing from the tables: its ticker, from PROVIDE_INFO's item2.
+        char vault_ticker[MAX_TICKER_LEN];
+        // ERC-4626 withdraw and redeem: whose shares are burnt, which may not be the sender.
+        struct {
+            uint8_t owner[ADDRESS_LENGTH];
+            uint8_t owner_checksum[ADDRESS_CHECKSUM_LENGTH];
+        };
+    };
+    uint16_t offset;          // Offset in the bytes[] of the next calldata word.
+    uint8_t batch_state : 3;  // `batch_state_t`
+    uint8_t batch_words : 3;  // Words of the current call, its length being 4 + 32 * batch_words.
+    uint8_t batch_count : 2;  // Number of calls.
+    uint8_t batch_call : 2;   // Index of the current call in `calls`.
+    uint8_t batch_param : 3;  // Index of the current word of the call in its PARAMETER_SCHEMAS.
 } context_t;
 
 // Piece of code that will check that the above structure is not bigger than 5 * 32. Do not remove
 // this check.
 _Static_assert(sizeof(context_t) <= 5 * 32, "Structure of parameters too big.");
 
+// Layout of context_t, so that a field growing by accident is caught at build time. Update the
+// sizes, and CONTEXT_SIZE, on purpose only.
+#define CONTEXT_SIZE 154
+#define CONTEXT_FIELD_SIZE(field, size) \
+    _Static_assert(sizeof(((context_t *) 0)->field) == (size), "context_t." #field " size changed")
+CONTEXT_FIELD_SIZE(amount, 32);
+CONTEXT_FIELD_SIZE(vault_address, 20);
+CONTEXT_FIELD_SIZE(extra_address, 20);
+CONTEXT_FIELD_SIZE(token_ticker, 12);
+CONTEXT_FIELD_SIZE(recipient_checksum, 5);
+CONTEXT_FIELD_SIZE(vault_checksum, 5);
+CONTEXT_FIELD_SIZE(slippage, 2);
+CONTEXT_FIELD_SIZE(decimals, 1);
+CONTEXT_FIELD_SIZE(chain_index, 1);
+CONTEXT_FIELD_SIZE(vault_index, 1);
+CONTEXT_FIELD_SIZE(checksums, 1);
+CONTEXT_FIELD_SIZE(screens, 1);
+CONTEXT_FIELD_SIZE(calls, MAX_BATCH_CALLS * 16);
+CONTEXT_FIELD_SIZE(owner, 20);
+CONTEXT_FIELD_SIZE(offset, 2);
+_Static_assert(NUM_SELECTORS <= 1 << 5, "Too many selectors for context_t.selectorIndex.");
+_Static_assert(MAX_PARAMS < 1 << 3, "Too many parameters for context_t.next_param.");
+_Static_assert(MAX_SCREENS <= 8, "Too many screens for context_t.screens.");
+_Static_assert(MAX_BATCH_CALLS < 1 << 2, "Too many calls for context_t.batch_count.");
+_Static_assert(MAX_PARAMS < 1 << 3, "Too many parameters for context_t.batch_words.");
+_Static_assert(MAX_PARAMS < 1 << 3, "Too many parameters for context_t.batch_param.");
+_Static_assert(BATCH_ERROR < 1 << 3, "Too many states for context_t.batch_state.");
+_Static_assert(sizeof(context_t) == CONTEXT_SIZE, "context_t size changed.");
+
+void dispatch_plugin_calls(int message, void *parameters);
 void handle_provide_token(void *parameters);
 void handle_provide_parameter(void *parameters);
 void handle_query_contract_ui(void *parameters);
 void handle_init_contract(void *parameters);
 void handle_finalize(void *parameters);
-void handle_query_contract_id(void *parameters);
\ No newline at end of file
+void handle_query_contract_id(void *parameters);
+
+uint8_t find_vault_index(const yearnVaultDefinition_t *vaults,
+                         uint8_t vaults_count,
+                         const uint8_t *address);
+uint8_t find_vault(uint8_t chain_index, uint64_t chain_id, bool iron_bank, const uint8_t *address);
+bool is_known_destination(const uint8_t *address);
+uint64_t get_chain_id(const txContent_t *content);
+uint8_t find_chain_index(uint64_t chain_id);
+const yearnVaultDefinition_t *get_vault_definition(const context_t *context);
+const yearnVaultDefinition_t *get_batch_vault_definition(const context_t *context, uint8_t call);
+const zapTokenDefinition_t *get_zap_token(const context_t *context);
+uint8_t find_selector_index(const uint8_t *selector);
+bool parse_batch_word(context_t *context, const uint8_t *word, const txContent_t *content);
+uint8_t get_batch_chain_index(const txContent_t *content);
+const flow_t *get_flow(const context_t *context);
+bool format_amount(const uint8_t *amount,
+                   uint8_t amount_size,
+                   uint8_t decimals,
+                   char *out,
+                   size_t out_size);
+void address_checksum_from_string(const char *string, uint8_t *checksum);
+void address_to_checksummed_string(const uint8_t *address, const uint8_t *checksum, char *out);
+void copy_vault_want(const yearnVaultDefinition_t *vault, char *out, size_t out_size);
+void copy_vault_name_string(const yearnVaultDefinition_t *vault, char *out, size_t out_size);
+void copy_zap_token_ticker(const zapTokenDefinition_t *token, char *out, size_t out_size);
+void copy_native_ticker(uint8_t chain_index, char *out, size_t out_size);
+#ifdef HAVE_NVM_REGISTRY
+uint8_t find_nvm_vault_index(uint64_t chain_id, bool iron_bank, const uint8_t *address);
+const yearnVaultDefinition_t *get_nvm_vault_definition(bool iron_bank, uint8_t index);
+bool is_nvm_destination(const uint8_t *address);
+const char *get_nvm_pool(void);
+uint16_t handle_registry_apdu(uint8_t ins,
+                              uint8_t p1,
+                              const uint8_t *data,
+                              uint8_t data_len,
+                              uint8_t *out,
+                              size_t *out_len);
+#endif
\ No newline at end of file
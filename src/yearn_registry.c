@@ -0,0 +1,1357 @@
+// Generated by tools/gen_registry.py from registry/yearn.json, do not edit.
+#include "yearn_plugin.h"
+
+static const uint8_t DEPOSIT_ALL_SELECTOR[SELECTOR_SIZE] = {0xd0, 0xe3, 0x0d, 0xb0};
+static const uint8_t DEPOSIT_SELECTOR[SELECTOR_SIZE] = {0xb6, 0xb5, 0x5f, 0x25};
+static const uint8_t DEPOSIT_TO_SELECTOR[SELECTOR_SIZE] = {0x6e, 0x55, 0x3f, 0x65};
+static const uint8_t WITHDRAW_ALL_SELECTOR[SELECTOR_SIZE] = {0x3c, 0xcf, 0xd6, 0x0b};
+static const uint8_t WITHDRAW_SELECTOR[SELECTOR_SIZE] = {0x2e, 0x1a, 0x7d, 0x4d};
+static const uint8_t WITHDRAW_TO_SELECTOR[SELECTOR_SIZE] = {0x00, 0xf7, 0x14, 0xce};
+static const uint8_t WITHDRAW_TO_SLIPPAGE_SELECTOR[SELECTOR_SIZE] = {0xe6, 0x36, 0x97, 0xc8};
+static const uint8_t ERC4626_MINT_SELECTOR[SELECTOR_SIZE] = {0x94, 0xbf, 0x80, 0x4d};
+static const uint8_t ERC4626_WITHDRAW_SELECTOR[SELECTOR_SIZE] = {0xb4, 0x60, 0xaf, 0x94};
+static const uint8_t ERC4626_REDEEM_SELECTOR[SELECTOR_SIZE] = {0xba, 0x08, 0x76, 0x52};
+static const uint8_t ZAP_IN_SELECTOR[SELECTOR_SIZE] = {0x38, 0xb3, 0x2e, 0x68};
+static const uint8_t ZAP_IN_PICKLE_SELECTOR[SELECTOR_SIZE] = {0x28, 0x93, 0x20, 0x94};
+static const uint8_t IB_MINT_SELECTOR[SELECTOR_SIZE] = {0xa0, 0x71, 0x2d, 0x68};
+static const uint8_t IB_REDEEM_SELECTOR[SELECTOR_SIZE] = {0xdb, 0x00, 0x6a, 0x75};
+static const uint8_t IB_REDEEM_UNDERLYING_SELECTOR[SELECTOR_SIZE] = {0x85, 0x2a, 0x12, 0xe3};
+static const uint8_t IB_BORROW_SELECTOR[SELECTOR_SIZE] = {0xc5, 0xeb, 0xea, 0xec};
+static const uint8_t IB_REPAY_BORROW_SELECTOR[SELECTOR_SIZE] = {0x0e, 0x75, 0x27, 0x02};
+static const uint8_t ROUTER_DEPOSIT_SELECTOR[SELECTOR_SIZE] = {0x90, 0xd2, 0x50, 0x74};
+static const uint8_t ROUTER_MINT_SELECTOR[SELECTOR_SIZE] = {0x3c, 0x17, 0x3a, 0x4f};
+static const uint8_t ROUTER_WITHDRAW_SELECTOR[SELECTOR_SIZE] = {0x4b, 0x20, 0x84, 0xe3};
+static const uint8_t ROUTER_REDEEM_SELECTOR[SELECTOR_SIZE] = {0xf3, 0xf0, 0x94, 0xa1};
+static const uint8_t MULTICALL_SELECTOR[SELECTOR_SIZE] = {0xac, 0x96, 0x50, 0xd8};
+static const uint8_t CLAIM_SELECTOR[SELECTOR_SIZE] = {0x4e, 0x71, 0xd9, 0x2d};
+static const uint8_t EXIT_SELECTOR[SELECTOR_SIZE] = {0xe9, 0xfa, 0xd8, 0xee};
+static const uint8_t GET_REWARDS_SELECTOR[SELECTOR_SIZE] = {0x3d, 0x18, 0xb9, 0x12};
+static const uint8_t DEPOSIT_ALL_YVECRV_SELECTOR[SELECTOR_SIZE] = {0xde, 0x5f, 0x62, 0x68};
+
+// Array of all the different boilerplate selectors, in `selector_t` order.
+const uint8_t *const YEARN_SELECTORS[NUM_SELECTORS] = {DEPOSIT_ALL_SELECTOR,
+                                                       DEPOSIT_SELECTOR,
+                                                       DEPOSIT_TO_SELECTOR,
+                                                       WITHDRAW_ALL_SELECTOR,
+                                                       WITHDRAW_SELECTOR,
+                                                       WITHDRAW_TO_SELECTOR,
+                                                       WITHDRAW_TO_SLIPPAGE_SELECTOR,
+                                                       ERC4626_MINT_SELECTOR,
+                                                       ERC4626_WITHDRAW_SELECTOR,
+                                                       ERC4626_REDEEM_SELECTOR,
+                                                       ZAP_IN_SELECTOR,
+                                                       ZAP_IN_PICKLE_SELECTOR,
+                                                       IB_MINT_SELECTOR,
+                                                       IB_REDEEM_SELECTOR,
+                                                       IB_REDEEM_UNDERLYING_SELECTOR,
+                                                       IB_BORROW_SELECTOR,
+                                                       IB_REPAY_BORROW_SELECTOR,
+                                                       ROUTER_DEPOSIT_SELECTOR,
+                                                       ROUTER_MINT_SELECTOR,
+                                                       ROUTER_WITHDRAW_SELECTOR,
+                                                       ROUTER_REDEEM_SELECTOR,
+                                                       MULTICALL_SELECTOR,
+                                                       CLAIM_SELECTOR,
+                                                       EXIT_SELECTOR,
+                                                       GET_REWARDS_SELECTOR,
+                                                       DEPOSIT_ALL_YVECRV_SELECTOR};
+
+// Calldata words of each selector, in `selector_t` order, see `handle_provide_parameter`.
+const param_slot_t PARAMETER_SCHEMAS[NUM_SELECTORS][MAX_PARAMS] = {
+    // DEPOSIT_ALL: no parameter
+    {{PARAM_END, 0}},
+    // DEPOSIT: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // DEPOSIT_TO: amount, recipient
+    {{PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)}},
+    // WITHDRAW_ALL: no parameter
+    {{PARAM_END, 0}},
+    // WITHDRAW: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // WITHDRAW_TO: amount, recipient
+    {{PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)}},
+    // WITHDRAW_TO_SLIPPAGE: amount, recipient, slippage
+    {{PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_UINT16, offsetof(context_t, slippage)}},
+    // ERC4626_MINT: amount, recipient
+    {{PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)}},
+    // ERC4626_WITHDRAW: amount, recipient, owner
+    {{PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_ADDRESS, offsetof(context_t, owner)}},
+    // ERC4626_REDEEM: amount, recipient, owner
+    {{PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_ADDRESS, offsetof(context_t, owner)}},
+    // ZAP_IN: token, amount, vault, rest
+    {{PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, vault_address)},
+     {PARAM_REST, 0}},
+    // ZAP_IN_PICKLE: token, amount, vault, rest
+    {{PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, vault_address)},
+     {PARAM_REST, 0}},
+    // IB_MINT: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // IB_REDEEM: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // IB_REDEEM_UNDERLYING: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // IB_BORROW: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // IB_REPAY_BORROW: amount
+    {{PARAM_UINT256, offsetof(context_t, amount)}},
+    // ROUTER_DEPOSIT: vault, amount, recipient, skip
+    {{PARAM_ADDRESS, offsetof(context_t, vault_address)},
+     {PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_SKIP, 0}},
+    // ROUTER_MINT: vault, amount, recipient, skip
+    {{PARAM_ADDRESS, offsetof(context_t, vault_address)},
+     {PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_SKIP, 0}},
+    // ROUTER_WITHDRAW: vault, amount, recipient, skip
+    {{PARAM_ADDRESS, offsetof(context_t, vault_address)},
+     {PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_SKIP, 0}},
+    // ROUTER_REDEEM: vault, amount, recipient, skip
+    {{PARAM_ADDRESS, offsetof(context_t, vault_address)},
+     {PARAM_UINT256, offsetof(context_t, amount)},
+     {PARAM_ADDRESS, offsetof(context_t, extra_address)},
+     {PARAM_SKIP, 0}},
+    // MULTICALL: calls
+    {{PARAM_CALLS, 0}},
+    // CLAIM: no parameter
+    {{PARAM_END, 0}},
+    // EXIT: no parameter
+    {{PARAM_END, 0}},
+    // GET_REWARDS: no parameter
+    {{PARAM_END, 0}},
+    // DEPOSIT_ALL_YVECRV: no parameter
+    {{PARAM_END, 0}}};
+
+// Name, version and screens of each selector, in `selector_t` order, see `get_flow`.
+const flow_t FLOWS[NUM_SELECTORS] = {
+    // DEPOSIT_ALL: deposit_all
+    {"Yearn", "Deposit", 0,
+     {SCREEN_AMOUNT_ALL, SCREEN_VAULT_NAME}},
+    // DEPOSIT: deposit
+    {"Yearn", "Deposit", 0,
+     {SCREEN_AMOUNT_WANT, SCREEN_VAULT_NAME}},
+    // DEPOSIT_TO: deposit_to
+    {"Yearn", "Deposit", 0,
+     {SCREEN_AMOUNT_WANT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // WITHDRAW_ALL: withdraw_all
+    {"Yearn", "Withdraw", 0,
+     {SCREEN_AMOUNT_ALL, SCREEN_VAULT_NAME}},
+    // WITHDRAW: withdraw
+    {"Yearn", "Withdraw", 0,
+     {SCREEN_AMOUNT_VAULT, SCREEN_VAULT_NAME}},
+    // WITHDRAW_TO: withdraw_to
+    {"Yearn", "Withdraw", 0,
+     {SCREEN_AMOUNT_VAULT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // WITHDRAW_TO_SLIPPAGE: withdraw_to_slippage
+    {"Yearn", "Withdraw", 0,
+     {SCREEN_AMOUNT_VAULT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT, SCREEN_SLIPPAGE}},
+    // ERC4626_MINT: deposit_shares
+    {"Yearn", "Deposit", 0,
+     {SCREEN_AMOUNT_VAULT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // ERC4626_WITHDRAW: withdraw_assets
+    {"Yearn", "Withdraw", 0,
+     {SCREEN_AMOUNT_WANT,
+      SCREEN_VAULT_NAME,
+      SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER,
+      SCREEN_OWNER | SCREEN_IF_NOT_SENDER}},
+    // ERC4626_REDEEM: redeem
+    {"Yearn", "Withdraw", 0,
+     {SCREEN_AMOUNT_VAULT,
+      SCREEN_VAULT_NAME,
+      SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER,
+      SCREEN_OWNER | SCREEN_IF_NOT_SENDER}},
+    // ZAP_IN: zap_in
+    {"Yearn", "Zap In", FLOW_VAULT_FROM_CALLDATA | FLOW_TOKEN_LOOKUP,
+     {SCREEN_AMOUNT_WANT, SCREEN_VAULT_NAME}},
+    // ZAP_IN_PICKLE: zap_in_pickle
+    {"Yearn", "Zap In", FLOW_VAULT_FROM_CALLDATA | FLOW_TOKEN_LOOKUP,
+     {SCREEN_AMOUNT_WANT, SCREEN_PICKLE_VAULT_NAME}},
+    // IB_MINT: ib_supply
+    {"IronBank", "Supply", FLOW_IRON_BANK,
+     {SCREEN_AMOUNT_WANT, SCREEN_BANK_NAME}},
+    // IB_REDEEM: ib_redeem
+    {"IronBank", "Redeem", FLOW_IRON_BANK,
+     {SCREEN_AMOUNT_BANK, SCREEN_BANK_NAME}},
+    // IB_REDEEM_UNDERLYING: ib_redeem_underlying
+    {"IronBank", "Redeem", FLOW_IRON_BANK,
+     {SCREEN_AMOUNT_WANT, SCREEN_BANK_NAME}},
+    // IB_BORROW: ib_borrow
+    {"IronBank", "Borrow", FLOW_IRON_BANK,
+     {SCREEN_AMOUNT_BANK, SCREEN_BANK_NAME}},
+    // IB_REPAY_BORROW: ib_repay
+    {"IronBank", "Repay", FLOW_IRON_BANK,
+     {SCREEN_AMOUNT_BANK, SCREEN_BANK_NAME}},
+    // ROUTER_DEPOSIT: router_deposit
+    {"Yearn", "Deposit", FLOW_VAULT_FROM_CALLDATA | FLOW_BATCHABLE,
+     {SCREEN_AMOUNT_WANT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // ROUTER_MINT: router_mint
+    {"Yearn", "Deposit", FLOW_VAULT_FROM_CALLDATA | FLOW_BATCHABLE,
+     {SCREEN_AMOUNT_VAULT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // ROUTER_WITHDRAW: router_withdraw
+    {"Yearn", "Withdraw", FLOW_VAULT_FROM_CALLDATA | FLOW_BATCHABLE,
+     {SCREEN_AMOUNT_WANT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // ROUTER_REDEEM: router_redeem
+    {"Yearn", "Withdraw", FLOW_VAULT_FROM_CALLDATA | FLOW_BATCHABLE,
+     {SCREEN_AMOUNT_VAULT, SCREEN_VAULT_NAME, SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // MULTICALL: multicall
+    {"Yearn", "Batch", FLOW_BATCH,
+     {SCREEN_BATCH_CALL,
+      SCREEN_BATCH_CALL,
+      SCREEN_BATCH_CALL,
+      SCREEN_RECIPIENT | SCREEN_IF_NOT_SENDER}},
+    // CLAIM: claim
+    {"Yearn", "Claim", 0,
+     {SCREEN_AMOUNT_ALL, SCREEN_VAULT_NAME}},
+    // EXIT: exit
+    {"Yearn", "Exit", 0,
+     {SCREEN_AMOUNT_ALL, SCREEN_VAULT_NAME}},
+    // GET_REWARDS: claim
+    {"Yearn", "Claim", 0,
+     {SCREEN_AMOUNT_ALL, SCREEN_VAULT_NAME}},
+    // DEPOSIT_ALL_YVECRV: deposit_all
+    {"Yearn", "Deposit", 0,
+     {SCREEN_AMOUNT_ALL, SCREEN_VAULT_NAME}}};
+
+// First 4 bytes of the address of every contract, all chains, sorted: see `is_known_destination`.
+const uint32_t DESTINATION_FINGERPRINTS[NUM_DESTINATIONS] = {
+    0x00E5C077u, 0x054AF22Eu, 0x09BDCCE2u, 0x0D4EA853u, 0x0DEC85E7u, 0x1112DBCFu, 0x12A9CC33u,
+    0x132D8D2Cu, 0x16825039u, 0x19D3364Au, 0x1B3E95E8u, 0x1B905331u, 0x1C6A9783u, 0x215F34AFu,
+    0x226F3738u, 0x23D3D0F1u, 0x25212DF2u, 0x27B7B1ADu, 0x28A5B95Cu, 0x297D4DA7u, 0x2A38B9B0u,
+    0x2DFB14E3u, 0x30190A3Bu, 0x30FCF7C6u, 0x378CB52Bu, 0x39CAF13Au, 0x3B96D491u, 0x3C5DF307u,
+    0x3C9F5385u, 0x3D27705Cu, 0x3D980E50u, 0x41C84C0Eu, 0x4560B99Cu, 0x48759F22u, 0x490BD088u,
+    0x4A3FE757u, 0x4B5BFD52u, 0x4F12C9DAu, 0x528D50DCu, 0x59518884u, 0x595A68A8u, 0x5A770DBDu,
+    0x5E69E8B5u, 0x5F18C75Au, 0x5FA5B62Cu, 0x625B7DF2u, 0x671A912Cu, 0x67247390u, 0x67E019BFu,
+    0x6D765CBEu, 0x6EDE7F19u, 0x6FAFCA7Fu, 0x7047F902u, 0x718ABE90u, 0x7589C9E1u, 0x76EB2FE2u,
+    0x7736FFB0u, 0x7DA96A38u, 0x801AB061u, 0x80BBEE2Fu, 0x8414DB07u, 0x84E13785u, 0x86BBD9ACu,
+    0x873FB544u, 0x8B9C0C24u, 0x8CC94CCDu, 0x8E595470u, 0x8EE57C05u, 0x8FA3A9ECu, 0x8FC8BFD8u,
+    0x92BE6ADBu, 0x95002763u, 0x986B4AFFu, 0x9D029CD7u, 0x9D409A0Au, 0x9E8E2070u, 0xA258C460u,
+    0xA354F358u, 0xA5CA62D9u, 0xA696A63Cu, 0xA74D4B67u, 0xA7C4054Au, 0xA8CAEA56u, 0xA9FE4601u,
+    0xB4ADA607u, 0xB4D1BE44u, 0xB8C3B7A2u, 0xB8C5AF54u, 0xBB4B067Cu, 0xBCBB5B54u, 0xBE53A109u,
+    0xBE86E891u, 0xBFA4D8AAu, 0xBFEDBCBEu, 0xC116DF49u, 0xC4DAF3B5u, 0xC5BDDF98u, 0xC695F73Cu,
+    0xCA55F9C4u, 0xCB550A6Du, 0xD6EA4059u, 0xD8C62099u, 0xD9788F39u, 0xDA481B27u, 0xDA816459u,
+    0xDB25CA70u, 0xDCD90C7Fu, 0xE11BA472u, 0xE14D13D8u, 0xE2F6B977u, 0xE537B5CCu, 0xE7BFF2DAu,
+    0xE9DC6308u, 0xECAB2C76u, 0xF29AE508u, 0xF2DB9A7Cu, 0xF59D66C1u, 0xF8768814u, 0xFA3472F7u,
+    0xFBEB78A7u, 0xFD0877D9u, 0xFEEB9238u};
+
+// Length-prefixed tickers, referenced by their offset in the pool.
+const char TICKER_POOL[TICKER_POOL_SIZE] =
+    "\x00" ""  // 0
+    "\x08" "yvCurve-"  // 1
+    "\x02" "yv"  // 10
+    "\x02" "cy"  // 13
+    "\x04" "HUSD"  // 16
+    "\x04" "EURT"  // 21
+    "\x07" "ankrETH"  // 26
+    "\x04" "D3-f"  // 34
+    "\x06" "d3pool"  // 39
+    "\x03" "DAI"  // 46
+    "\x05" "ibAUD"  // 50
+    "\x03" "UST"  // 56
+    "\x04" "tBTC"  // 60
+    "\x04" "EURS"  // 65
+    "\x08" "IronBank"  // 70
+    "\x04" "USDT"  // 79
+    "\x04" "GUSD"  // 84
+    "\x03" "MIM"  // 89
+    "\x04" "DUSD"  // 93
+    "\x04" "LUSD"  // 98
+    "\x04" "Aave"  // 103
+    "\x04" "USDN"  // 108
+    "\x04" "pBTC"  // 113
+    "\x04" "USDK"  // 118
+    "\x09" "triCrypto"  // 123
+    "\x06" "cvxCRV"  // 133
+    "\x05" "ibCHF"  // 140
+    "\x04" "COMP"  // 146
+    "\x01" "y"  // 151
+    "\x04" "yUSD"  // 153
+    "\x05" "ibKRW"  // 158
+    "\x05" "ibJPY"  // 164
+    "\x05" "ibGBP"  // 170
+    "\x04" "sUSD"  // 176
+    "\x05" "ibBTC"  // 181
+    "\x04" "USDC"  // 187
+    "\x04" "HBTC"  // 192
+    "\x04" "LINK"  // 197
+    "\x05" "ibEUR"  // 202
+    "\x05" "SUSHI"  // 208
+    "\x04" "BUSD"  // 214
+    "\x04" "USDM"  // 219
+    "\x06" "renBTC"  // 224
+    "\x05" "alETH"  // 231
+    "\x0b" "crvEURSUSDC"  // 237
+    "\x08" "EURSUSDC"  // 249
+    "\x03" "Pax"  // 258
+    "\x04" "sBTC"  // 262
+    "\x05" "3pool"  // 267
+    "\x03" "RAI"  // 273
+    "\x04" "EURN"  // 277
+    "\x04" "mUSD"  // 282
+    "\x05" "yBUSD"  // 287
+    "\x04" "BBTC"  // 293
+    "\x04" "sETH"  // 298
+    "\x06" "yveCRV"  // 303
+    "\x05" "BOOST"  // 310
+    "\x04" "WETH"  // 316
+    "\x04" "WBTC"  // 321
+    "\x05" "alUSD"  // 326
+    "\x04" "FRAX"  // 332
+    "\x05" "sAave"  // 337
+    "\x05" "1INCH"  // 343
+    "\x0a" "crvEURTUSD"  // 349
+    "\x07" "EURTUSD"  // 360
+    "\x06" "USDC-1"  // 368
+    "\x04" "rETH"  // 375
+    "\x03" "RSV"  // 380
+    "\x04" "USDP"  // 384
+    "\x03" "CRV"  // 389
+    "\x04" "eCRV"  // 393
+    "\x08" "Compound"  // 398
+    "\x06" "MIMUST"  // 407
+    "\x04" "AAVE"  // 414
+    "\x0a" "Pickle SLP"  // 419
+    "\x0f" "pSLPyvBOOST-ETH"  // 430
+    "\x03" "YFI"  // 446
+    "\x05" "stETH"  // 450
+    "\x05" "HEGIC"  // 456
+    "\x07" "3Crypto"  // 462
+    "\x04" "oBTC"  // 470
+    "\x03" "SNX"  // 475
+    "\x0a" "OUSD3CRV-f"  // 479
+    "\x04" "OUSD"  // 490
+    "\x04" "TUSD"  // 495
+    "\x03" "UNI"  // 500
+    "\x03" "EUR"  // 504
+    "\x03" "CHF"  // 508
+    "\x03" "JPY"  // 512
+    "\x03" "KRW"  // 516
+    "\x04" "CDAI"  // 520
+    "\x03" "ZAR"  // 525
+    "\x05" "Y3CRV"  // 529
+    "\x03" "DPI"  // 535
+    "\x03" "AUD"  // 539
+    "\x05" "CUSDC"  // 543
+    "\x05" "CREAM"  // 549
+    "\x04" "SUSD"  // 555
+    "\x05" "CUSDT"  // 560
+    "\x04" "MUSD"  // 566
+    "\x04" "SEUR"  // 571
+    "\x03" "GBP"  // 576
+    "\x04" "WFTM"  // 580
+    "\x03" "ETH"  // 585
+    "\x03" "FTM";  // 589
+
+// Offset in TICKER_POOL of each `vault_prefix_t`.
+const uint16_t VAULT_PREFIXES[NUM_VAULT_PREFIXES] = {0, 1, 10, 13};
+
+// Sorted by address, see `find_vault_index`.
+static const yearnVaultDefinition_t YEARN_VAULTS_ETHEREUM[86] = {
+    // HUSD, yvCurve-HUSD, 0x054AF22E1519b020516D72D749221c24756385C9
+    {{0x05, 0x4a, 0xf2, 0x2e, 0x15, 0x19, 0xb0, 0x20, 0x51, 0x6d,
+      0x72, 0xd7, 0x49, 0x22, 0x1c, 0x24, 0x75, 0x63, 0x85, 0xc9},
+     16,
+     16,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x19, 0x00, 0x12, 0x00, 0x02}},
+    // EURT, yvCurve-EURT, 0x0d4EA8536F9A13e4FBa16042a46c30f092b06aA5
+    {{0x0d, 0x4e, 0xa8, 0x53, 0x6f, 0x9a, 0x13, 0xe4, 0xfb, 0xa1,
+      0x60, 0x42, 0xa4, 0x6c, 0x30, 0xf0, 0x92, 0xb0, 0x6a, 0xa5},
+     21,
+     21,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x18, 0x50, 0xc0, 0x00, 0x02}},
+    // ankrETH, yvCurve-ankrETH, 0x132d8D2C76Db3812403431fAcB00F3453Fc42125
+    {{0x13, 0x2d, 0x8d, 0x2c, 0x76, 0xdb, 0x38, 0x12, 0x40, 0x34,
+      0x31, 0xfa, 0xcb, 0x00, 0xf3, 0x45, 0x3f, 0xc4, 0x21, 0x25},
+     26,
+     26,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x05, 0x20, 0x01, 0x48, 0x40}},
+    // D3-f, yvCurve-d3pool, 0x16825039dfe2a5b01F3E1E6a2BBF9a576c6F95c4
+    {{0x16, 0x82, 0x50, 0x39, 0xdf, 0xe2, 0xa5, 0xb0, 0x1f, 0x3e,
+      0x1e, 0x6a, 0x2b, 0xbf, 0x9a, 0x57, 0x6c, 0x6f, 0x95, 0xc4},
+     34,
+     39,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x00, 0x54, 0x70, 0x10}},
+    // DAI, yvDAI, 0x19D3364A399d251E894aC732651be8B0E4e85001
+    {{0x19, 0xd3, 0x36, 0x4a, 0x39, 0x9d, 0x25, 0x1e, 0x89, 0x4a,
+      0xc7, 0x32, 0x65, 0x1b, 0xe8, 0xb0, 0xe4, 0xe8, 0x50, 0x01},
+     46,
+     46,
+     VAULT_PREFIX_YV,
+     18,
+     {0x21, 0x01, 0x08, 0x02, 0x80}},
+    // ibAUD, yvCurve-ibAUD, 0x1b905331F7dE2748F4D6a0678e1521E20347643F
+    {{0x1b, 0x90, 0x53, 0x31, 0xf7, 0xde, 0x27, 0x48, 0xf4, 0xd6,
+      0xa0, 0x67, 0x8e, 0x15, 0x21, 0xe2, 0x03, 0x47, 0x64, 0x3f},
+     50,
+     50,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x90, 0xa0, 0x02, 0x01}},
+    // UST, yvCurve-UST, 0x1C6a9783F812b3Af3aBbf7de64c3cD7CC7D1af44
+    {{0x1c, 0x6a, 0x97, 0x83, 0xf8, 0x12, 0xb3, 0xaf, 0x3a, 0xbb,
+      0xf7, 0xde, 0x64, 0xc3, 0xcd, 0x7c, 0xc7, 0xd1, 0xaf, 0x44},
+     56,
+     56,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x40, 0x82, 0x20, 0x05, 0xa0}},
+    // tBTC, yvCurve-tBTC, 0x23D3D0f1c697247d5e0a9efB37d8b0ED0C464f7f
+    {{0x23, 0xd3, 0xd0, 0xf1, 0xc6, 0x97, 0x24, 0x7d, 0x5e, 0x0a,
+      0x9e, 0xfb, 0x37, 0xd8, 0xb0, 0xed, 0x0c, 0x46, 0x4f, 0x7f},
+     60,
+     60,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x28, 0x00, 0x01, 0x03, 0x40}},
+    // EURS, yvCurve-EURS, 0x25212Df29073FfFA7A67399AcEfC2dd75a831A1A
+    {{0x25, 0x21, 0x2d, 0xf2, 0x90, 0x73, 0xff, 0xfa, 0x7a, 0x67,
+      0x39, 0x9a, 0xce, 0xfc, 0x2d, 0xd7, 0x5a, 0x83, 0x1a, 0x1a},
+     65,
+     65,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x04, 0x0b, 0x41, 0x50, 0x05}},
+    // IronBank, yvCurve-IronBank, 0x27b7b1ad7288079A66d12350c828D3C00A6F07d7
+    {{0x27, 0xb7, 0xb1, 0xad, 0x72, 0x88, 0x07, 0x9a, 0x66, 0xd1,
+      0x23, 0x50, 0xc8, 0x28, 0xd3, 0xc0, 0x0a, 0x6f, 0x07, 0xd7},
+     70,
+     70,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x01, 0x00, 0x0a, 0x50}},
+    // USDT, yvCurve-USDT, 0x28a5b95C101df3Ded0C0d9074DB80C438774B6a9
+    {{0x28, 0xa5, 0xb9, 0x5c, 0x10, 0x1d, 0xf3, 0xde, 0xd0, 0xc0,
+      0xd9, 0x07, 0x4d, 0xb8, 0x0c, 0x43, 0x87, 0x74, 0xb6, 0xa9},
+     79,
+     79,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x01, 0x02, 0x20, 0x64, 0x08}},
+    // GUSD, yvCurve-GUSD, 0x2a38B9B0201Ca39B17B460eD2f11e4929559071E
+    {{0x2a, 0x38, 0xb9, 0xb0, 0x20, 0x1c, 0xa3, 0x9b, 0x17, 0xb4,
+      0x60, 0xed, 0x2f, 0x11, 0xe4, 0x92, 0x95, 0x59, 0x07, 0x1e},
+     84,
+     84,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x0a, 0x11, 0x21, 0x00, 0x01}},
+    // MIM, yvCurve-MIM, 0x2DfB14E32e2F8156ec15a2c21c3A6c053af52Be8
+    {{0x2d, 0xfb, 0x14, 0xe3, 0x2e, 0x2f, 0x81, 0x56, 0xec, 0x15,
+      0xa2, 0xc2, 0x1c, 0x3a, 0x6c, 0x05, 0x3a, 0xf5, 0x2b, 0xe8},
+     89,
+     89,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x52, 0x10, 0x00, 0x10, 0x04}},
+    // DUSD, yvCurve-DUSD, 0x30FCf7c6cDfC46eC237783D94Fc78553E79d4E9C
+    {{0x30, 0xfc, 0xf7, 0xc6, 0xcd, 0xfc, 0x46, 0xec, 0x23, 0x77,
+      0x83, 0xd9, 0x4f, 0xc7, 0x85, 0x53, 0xe7, 0x9d, 0x4e, 0x9c},
+     93,
+     93,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x30, 0x51, 0x02, 0x40, 0x85}},
+    // LUSD, yvLUSD, 0x378cb52b00F9D0921cb46dFc099CFf73b42419dC
+    {{0x37, 0x8c, 0xb5, 0x2b, 0x00, 0xf9, 0xd0, 0x92, 0x1c, 0xb4,
+      0x6d, 0xfc, 0x09, 0x9c, 0xff, 0x73, 0xb4, 0x24, 0x19, 0xdc},
+     98,
+     98,
+     VAULT_PREFIX_YV,
+     18,
+     {0x00, 0x28, 0x02, 0x18, 0x01}},
+    // Aave, yvCurve-Aave, 0x39CAF13a104FF567f71fd2A4c68C026FDB6E740B
+    {{0x39, 0xca, 0xf1, 0x3a, 0x10, 0x4f, 0xf5, 0x67, 0xf7, 0x1f,
+      0xd2, 0xa4, 0xc6, 0x8c, 0x02, 0x6f, 0xdb, 0x6e, 0x74, 0x0b},
+     103,
+     103,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x38, 0x18, 0x02, 0x11, 0xd1}},
+    // USDN, yvCurve-USDN, 0x3B96d491f067912D18563d56858Ba7d6EC67a6fa
+    {{0x3b, 0x96, 0xd4, 0x91, 0xf0, 0x67, 0x91, 0x2d, 0x18, 0x56,
+      0x3d, 0x56, 0x85, 0x8b, 0xa7, 0xd6, 0xec, 0x67, 0xa6, 0xfa},
+     108,
+     108,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x40, 0x01, 0x00, 0x10, 0xc0}},
+    // pBTC, yvCurve-pBTC, 0x3c5DF3077BcF800640B5DAE8c91106575a4826E6
+    {{0x3c, 0x5d, 0xf3, 0x07, 0x7b, 0xcf, 0x80, 0x06, 0x40, 0xb5,
+      0xda, 0xe8, 0xc9, 0x11, 0x06, 0x57, 0x5a, 0x48, 0x26, 0xe6},
+     113,
+     113,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x18, 0x50, 0x2e, 0x00, 0x02}},
+    // USDK, yvCurve-USDK, 0x3D27705c64213A5DcD9D26880c1BcFa72d5b6B0E
+    {{0x3d, 0x27, 0x70, 0x5c, 0x64, 0x21, 0x3a, 0x5d, 0xcd, 0x9d,
+      0x26, 0x88, 0x0c, 0x1b, 0xcf, 0xa7, 0x2d, 0x5b, 0x6b, 0x0e},
+     118,
+     118,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x40, 0x05, 0x50, 0x14, 0x05}},
+    // triCrypto, yvCurve-triCrypto, 0x3D980E50508CFd41a13837A60149927a11c03731
+    {{0x3d, 0x98, 0x0e, 0x50, 0x50, 0x8c, 0xfd, 0x41, 0xa1, 0x38,
+      0x37, 0xa6, 0x01, 0x49, 0x92, 0x7a, 0x11, 0xc0, 0x37, 0x31},
+     123,
+     123,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x44, 0x18, 0x02, 0x00, 0x00}},
+    // cvxCRV, yvCurve-cvxCRV, 0x4560b99C904aAD03027B5178CCa81584744AC01f
+    {{0x45, 0x60, 0xb9, 0x9c, 0x90, 0x4a, 0xad, 0x03, 0x02, 0x7b,
+      0x51, 0x78, 0xcc, 0xa8, 0x15, 0x84, 0x74, 0x4a, 0xc0, 0x1f},
+     133,
+     133,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x01, 0x0c, 0x10, 0xc0, 0x18}},
+    // ibCHF, yvCurve-ibCHF, 0x490bD0886F221A5F79713D3E84404355A9293C50
+    {{0x49, 0x0b, 0xd0, 0x88, 0x6f, 0x22, 0x1a, 0x5f, 0x79, 0x71,
+      0x3d, 0x3e, 0x84, 0x40, 0x43, 0x55, 0xa9, 0x29, 0x3c, 0x50},
+     140,
+     140,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x08, 0x45, 0x05, 0x00, 0x84}},
+    // COMP, yvCOMP, 0x4A3FE75762017DB0eD73a71C9A06db7768DB5e66
+    {{0x4a, 0x3f, 0xe7, 0x57, 0x62, 0x01, 0x7d, 0xb0, 0xed, 0x73,
+      0xa7, 0x1c, 0x9a, 0x06, 0xdb, 0x77, 0x68, 0xdb, 0x5e, 0x66},
+     146,
+     146,
+     VAULT_PREFIX_YV,
+     18,
+     {0x58, 0x06, 0x41, 0x40, 0x30}},
+    // y, yUSD, 0x4B5BfD52124784745c1071dcB244C6688d2533d3
+    {{0x4b, 0x5b, 0xfd, 0x52, 0x12, 0x47, 0x84, 0x74, 0x5c, 0x10,
+      0x71, 0xdc, 0xb2, 0x44, 0xc6, 0x68, 0x8d, 0x25, 0x33, 0xd3},
+     151,
+     153,
+     VAULT_PREFIX_NONE,
+     18,
+     {0x54, 0x00, 0x00, 0x88, 0x00}},
+    // ibKRW, yvCurve-ibKRW, 0x528D50dC9a333f01544177a924893FA1F5b9F748
+    {{0x52, 0x8d, 0x50, 0xdc, 0x9a, 0x33, 0x3f, 0x01, 0x54, 0x41,
+      0x77, 0xa9, 0x24, 0x89, 0x3f, 0xa1, 0xf5, 0xb9, 0xf7, 0x48},
+     158,
+     158,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x11, 0x00, 0x00, 0x06, 0x88}},
+    // ibJPY, yvCurve-ibJPY, 0x59518884EeBFb03e90a18ADBAAAB770d4666471e
+    {{0x59, 0x51, 0x88, 0x84, 0xee, 0xbf, 0xb0, 0x3e, 0x90, 0xa1,
+      0x8a, 0xdb, 0xaa, 0xab, 0x77, 0x0d, 0x46, 0x66, 0x47, 0x1e},
+     164,
+     164,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0xb0, 0x07, 0xf0, 0x00}},
+    // ibGBP, yvCurve-ibGBP, 0x595a68a8c9D5C230001848B69b1947ee2A607164
+    {{0x59, 0x5a, 0x68, 0xa8, 0xc9, 0xd5, 0xc2, 0x30, 0x00, 0x18,
+      0x48, 0xb6, 0x9b, 0x19, 0x47, 0xee, 0x2a, 0x60, 0x71, 0x64},
+     170,
+     170,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x28, 0x02, 0x00, 0x40}},
+    // sUSD, yvCurve-sUSD, 0x5a770DbD3Ee6bAF2802D29a901Ef11501C44797A
+    {{0x5a, 0x77, 0x0d, 0xbd, 0x3e, 0xe6, 0xba, 0xf2, 0x80, 0x2d,
+      0x29, 0xa9, 0x01, 0xef, 0x11, 0x50, 0x1c, 0x44, 0x79, 0x7a},
+     176,
+     176,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x05, 0x46, 0x10, 0x20, 0x41}},
+    // ibBTC, yvCurve-ibBTC, 0x5e69e8b51B71C8596817fD442849BD44219bb095
+    {{0x5e, 0x69, 0xe8, 0xb5, 0x1b, 0x71, 0xc8, 0x59, 0x68, 0x17,
+      0xfd, 0x44, 0x28, 0x49, 0xbd, 0x44, 0x21, 0x9b, 0xb0, 0x95},
+     181,
+     181,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x48, 0x04, 0x0c, 0x00}},
+    // USDC, yvUSDC, 0x5f18C75AbDAe578b483E5F43f12a39cF75b973a9
+    {{0x5f, 0x18, 0xc7, 0x5a, 0xbd, 0xae, 0x57, 0x8b, 0x48, 0x3e,
+      0x5f, 0x43, 0xf1, 0x2a, 0x39, 0xcf, 0x75, 0xb9, 0x73, 0xa9},
+     187,
+     187,
+     VAULT_PREFIX_YV,
+     6,
+     {0x09, 0x60, 0x14, 0x01, 0x00}},
+    // LUSD, yvCurve-LUSD, 0x5fA5B62c8AF877CB37031e0a3B2f34A78e3C56A6
+    {{0x5f, 0xa5, 0xb6, 0x2c, 0x8a, 0xf8, 0x77, 0xcb, 0x37, 0x03,
+      0x1e, 0x0a, 0x3b, 0x2f, 0x34, 0xa7, 0x8e, 0x3c, 0x56, 0xa6},
+     98,
+     98,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x28, 0x63, 0x00, 0x42, 0x12}},
+    // HBTC, yvCurve-HBTC, 0x625b7DF2fa8aBe21B0A976736CDa4775523aeD1E
+    {{0x62, 0x5b, 0x7d, 0xf2, 0xfa, 0x8a, 0xbe, 0x21, 0xb0, 0xa9,
+      0x76, 0x73, 0x6c, 0xda, 0x47, 0x75, 0x52, 0x3a, 0xed, 0x1e},
+     192,
+     192,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x06, 0x08, 0xa0, 0x60, 0x05}},
+    // LINK, yvLINK, 0x671a912C10bba0CFA74Cfc2d6Fba9BA1ed9530B2
+    {{0x67, 0x1a, 0x91, 0x2c, 0x10, 0xbb, 0xa0, 0xcf, 0xa7, 0x4c,
+      0xfc, 0x2d, 0x6f, 0xba, 0x9b, 0xa1, 0xed, 0x95, 0x30, 0xb2},
+     197,
+     197,
+     VAULT_PREFIX_YV,
+     18,
+     {0x01, 0x03, 0x90, 0x46, 0x02}},
+    // ibEUR, yvCurve-ibEUR, 0x67e019bfbd5a67207755D04467D6A70c0B75bF60
+    {{0x67, 0xe0, 0x19, 0xbf, 0xbd, 0x5a, 0x67, 0x20, 0x77, 0x55,
+      0xd0, 0x44, 0x67, 0xd6, 0xa7, 0x0c, 0x0b, 0x75, 0xbf, 0x60},
+     202,
+     202,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x00, 0x08, 0x28, 0x44}},
+    // SUSHI, yvSUSHI, 0x6d765CbE5bC922694afE112C140b8878b9FB0390
+    {{0x6d, 0x76, 0x5c, 0xbe, 0x5b, 0xc9, 0x22, 0x69, 0x4a, 0xfe,
+      0x11, 0x2c, 0x14, 0x0b, 0x88, 0x78, 0xb9, 0xfb, 0x03, 0x90},
+     208,
+     208,
+     VAULT_PREFIX_YV,
+     18,
+     {0x05, 0x20, 0x11, 0x00, 0x30}},
+    // BUSD, yvCurve-BUSD, 0x6Ede7F19df5df6EF23bD5B9CeDb651580Bdf56Ca
+    {{0x6e, 0xde, 0x7f, 0x19, 0xdf, 0x5d, 0xf6, 0xef, 0x23, 0xbd,
+      0x5b, 0x9c, 0xed, 0xb6, 0x51, 0x58, 0x0b, 0xdf, 0x56, 0xca},
+     214,
+     214,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x44, 0x03, 0x15, 0x40, 0x42}},
+    // USDM, yvCurve-USDM, 0x6FAfCA7f49B4Fd9dC38117469cd31A1E5aec91F5
+    {{0x6f, 0xaf, 0xca, 0x7f, 0x49, 0xb4, 0xfd, 0x9d, 0xc3, 0x81,
+      0x17, 0x46, 0x9c, 0xd3, 0x1a, 0x1e, 0x5a, 0xec, 0x91, 0xf5},
+     219,
+     219,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x6c, 0x28, 0x80, 0x05, 0x02}},
+    // renBTC, yvCurve-renBTC, 0x7047F90229a057C13BF847C0744D646CFb6c9E1A
+    {{0x70, 0x47, 0xf9, 0x02, 0x29, 0xa0, 0x57, 0xc1, 0x3b, 0xf8,
+      0x47, 0xc0, 0x74, 0x4d, 0x64, 0x6c, 0xfb, 0x6c, 0x9e, 0x1a},
+     224,
+     224,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x08, 0x02, 0x62, 0x11, 0x85}},
+    // alETH, yvCurve-alETH, 0x718AbE90777F5B778B52D553a5aBaa148DD0dc5D
+    {{0x71, 0x8a, 0xbe, 0x90, 0x77, 0x7f, 0x5b, 0x77, 0x8b, 0x52,
+      0xd5, 0x53, 0xa5, 0xab, 0xaa, 0x14, 0x8d, 0xd0, 0xdc, 0x5d},
+     231,
+     231,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x14, 0x14, 0x48, 0x10, 0x61}},
+    // USDT, yvUSDT, 0x7Da96a3891Add058AdA2E826306D812C638D87a7
+    {{0x7d, 0xa9, 0x6a, 0x38, 0x91, 0xad, 0xd0, 0x58, 0xad, 0xa2,
+      0xe8, 0x26, 0x30, 0x6d, 0x81, 0x2c, 0x63, 0x8d, 0x87, 0xa7},
+     79,
+     79,
+     VAULT_PREFIX_YV,
+     6,
+     {0x40, 0x20, 0xa8, 0x11, 0x10}},
+    // crvEURSUSDC, yvCurve-EURSUSDC, 0x801Ab06154Bf539dea4385a39f5fa8534fB53073
+    {{0x80, 0x1a, 0xb0, 0x61, 0x54, 0xbf, 0x53, 0x9d, 0xea, 0x43,
+      0x85, 0xa3, 0x9f, 0x5f, 0xa8, 0x53, 0x4f, 0xb5, 0x30, 0x73},
+     237,
+     249,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x10, 0x20, 0x00, 0x00, 0x20}},
+    // Pax, yvCurve-Pax, 0x80bbeE2fa460dA291e796B9045e93d19eF948C6A
+    {{0x80, 0xbb, 0xee, 0x2f, 0xa4, 0x60, 0xda, 0x29, 0x1e, 0x79,
+      0x6b, 0x90, 0x45, 0xe9, 0x3d, 0x19, 0xef, 0x94, 0x8c, 0x6a},
+     258,
+     258,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x04, 0x04, 0x04, 0x00, 0x45}},
+    // sBTC, yvCurve-sBTC, 0x8414Db07a7F743dEbaFb402070AB01a4E0d2E45e
+    {{0x84, 0x14, 0xdb, 0x07, 0xa7, 0xf7, 0x43, 0xde, 0xba, 0xfb,
+      0x40, 0x20, 0x70, 0xab, 0x01, 0xa4, 0xe0, 0xd2, 0xe4, 0x5e},
+     262,
+     262,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x08, 0x21, 0x20, 0x30, 0x88}},
+    // 3pool, yvCurve-3pool, 0x84E13785B5a27879921D6F685f041421C7F482dA
+    {{0x84, 0xe1, 0x37, 0x85, 0xb5, 0xa2, 0x78, 0x79, 0x92, 0x1d,
+      0x6f, 0x68, 0x5f, 0x04, 0x14, 0x21, 0xc7, 0xf4, 0x82, 0xda},
+     267,
+     267,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x20, 0x80, 0x14, 0x00, 0xa1}},
+    // RAI, yvRAI, 0x873fB544277FD7b977B196a826459a69E27eA4ea
+    {{0x87, 0x3f, 0xb5, 0x44, 0x27, 0x7f, 0xd7, 0xb9, 0x77, 0xb1,
+      0x96, 0xa8, 0x26, 0x45, 0x9a, 0x69, 0xe2, 0x7e, 0xa4, 0xea},
+     273,
+     273,
+     VAULT_PREFIX_YV,
+     18,
+     {0x08, 0x18, 0x20, 0x00, 0x88}},
+    // EURN, yvCurve-EURN, 0x8b9C0c24307344B6D7941ab654b2Aeee25347473
+    {{0x8b, 0x9c, 0x0c, 0x24, 0x30, 0x73, 0x44, 0xb6, 0xd7, 0x94,
+      0x1a, 0xb6, 0x54, 0xb2, 0xae, 0xee, 0x25, 0x34, 0x74, 0x73},
+     277,
+     277,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x10, 0x02, 0x80, 0x08, 0x00}},
+    // mUSD, yvCurve-mUSD, 0x8cc94ccd0f3841a468184aCA3Cc478D2148E1757
+    {{0x8c, 0xc9, 0x4c, 0xcd, 0x0f, 0x38, 0x41, 0xa4, 0x68, 0x18,
+      0x4a, 0xca, 0x3c, 0xc4, 0x78, 0xd2, 0x14, 0x8e, 0x17, 0x57},
+     282,
+     282,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x00, 0x03, 0x42, 0x10}},
+    // yBUSD, yvCurve-yBUSD, 0x8ee57c05741aA9DB947A744E713C15d4d19D8822
+    {{0x8e, 0xe5, 0x7c, 0x05, 0x74, 0x1a, 0xa9, 0xdb, 0x94, 0x7a,
+      0x74, 0x4e, 0x71, 0x3c, 0x15, 0xd4, 0xd1, 0x9d, 0x88, 0x22},
+     287,
+     287,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x0b, 0x11, 0x10, 0x10}},
+    // BBTC, yvCurve-BBTC, 0x8fA3A9ecd9EFb07A8CE90A6eb014CF3c0E3B32Ef
+    {{0x8f, 0xa3, 0xa9, 0xec, 0xd9, 0xef, 0xb0, 0x7a, 0x8c, 0xe9,
+      0x0a, 0x6e, 0xb0, 0x14, 0xcf, 0x3c, 0x0e, 0x3b, 0x32, 0xef},
+     293,
+     293,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x28, 0x31, 0x64, 0x0c, 0x52}},
+    // sETH, yvCurve-sETH, 0x986b4AFF588a109c09B50A03f42E4110E29D353F
+    {{0x98, 0x6b, 0x4a, 0xff, 0x58, 0x8a, 0x10, 0x9c, 0x09, 0xb5,
+      0x0a, 0x03, 0xf4, 0x2e, 0x41, 0x10, 0xe2, 0x9d, 0x35, 0x3f},
+     298,
+     298,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x07, 0x00, 0x24, 0x10, 0x91}},
+    // yveCRV, yvBOOST, 0x9d409a0A012CFbA9B15F6D4B36Ac57A46966Ab9a
+    {{0x9d, 0x40, 0x9a, 0x0a, 0x01, 0x2c, 0xfb, 0xa9, 0xb1, 0x5f,
+      0x6d, 0x4b, 0x36, 0xac, 0x57, 0xa4, 0x69, 0x66, 0xab, 0x9a},
+     303,
+     310,
+     VAULT_PREFIX_YV,
+     18,
+     {0x01, 0x1a, 0x95, 0x22, 0x08}},
+    // WETH, yvWETH, 0xa258C4606Ca8206D8aA700cE2143D7db854D168c
+    {{0xa2, 0x58, 0xc4, 0x60, 0x6c, 0xa8, 0x20, 0x6d, 0x8a, 0xa7,
+      0x00, 0xce, 0x21, 0x43, 0xd7, 0xdb, 0x85, 0x4d, 0x16, 0x8c},
+     316,
+     316,
+     VAULT_PREFIX_YV,
+     18,
+     {0x08, 0x41, 0x21, 0x08, 0x10}},
+    // USDC, yvUSDC, 0xa354F35829Ae975e850e23e9615b11Da1B3dC4DE
+    {{0xa3, 0x54, 0xf3, 0x58, 0x29, 0xae, 0x97, 0x5e, 0x85, 0x0e,
+      0x23, 0xe9, 0x61, 0x5b, 0x11, 0xda, 0x1b, 0x3d, 0xc4, 0xde},
+     187,
+     187,
+     VAULT_PREFIX_YV,
+     6,
+     {0x08, 0x20, 0x00, 0x02, 0x4b}},
+    // sUSD, yvsUSD, 0xa5cA62D95D24A4a350983D5B8ac4EB8638887396
+    {{0xa5, 0xca, 0x62, 0xd9, 0x5d, 0x24, 0xa4, 0xa3, 0x50, 0x98,
+      0x3d, 0x5b, 0x8a, 0xc4, 0xeb, 0x86, 0x38, 0x88, 0x73, 0x96},
+     176,
+     176,
+     VAULT_PREFIX_YV,
+     18,
+     {0x12, 0x48, 0x05, 0x0c, 0x00}},
+    // WBTC, yvWBTC, 0xA696a63cc78DfFa1a63E9E50587C197387FF6C7E
+    {{0xa6, 0x96, 0xa6, 0x3c, 0xc7, 0x8d, 0xff, 0xa1, 0xa6, 0x3e,
+      0x9e, 0x50, 0x58, 0x7c, 0x19, 0x73, 0x87, 0xff, 0x6c, 0x7e},
+     321,
+     321,
+     VAULT_PREFIX_YV,
+     8,
+     {0x80, 0x14, 0x14, 0x10, 0x35}},
+    // alUSD, yvCurve-alUSD, 0xA74d4B67b3368E83797a35382AFB776bAAE4F5C8
+    {{0xa7, 0x4d, 0x4b, 0x67, 0xb3, 0x36, 0x8e, 0x83, 0x79, 0x7a,
+      0x35, 0x38, 0x2a, 0xfb, 0x77, 0x6b, 0xaa, 0xe4, 0xf5, 0xc8},
+     326,
+     326,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x84, 0x04, 0x00, 0x70, 0xea}},
+    // WETH, yvWETH, 0xa9fE4601811213c340e850ea305481afF02f5b28
+    {{0xa9, 0xfe, 0x46, 0x01, 0x81, 0x12, 0x13, 0xc3, 0x40, 0xe8,
+      0x50, 0xea, 0x30, 0x54, 0x81, 0xaf, 0xf0, 0x2f, 0x5b, 0x28},
+     316,
+     316,
+     VAULT_PREFIX_YV,
+     18,
+     {0x10, 0x00, 0x00, 0x00, 0x80}},
+    // FRAX, yvCurve-FRAX, 0xB4AdA607B9d6b2c9Ee07A275e9616B84AC560139
+    {{0xb4, 0xad, 0xa6, 0x07, 0xb9, 0xd6, 0xb2, 0xc9, 0xee, 0x07,
+      0xa2, 0x75, 0xe9, 0x61, 0x6b, 0x84, 0xac, 0x56, 0x01, 0x39},
+     332,
+     332,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0xa8, 0x80, 0x88, 0x04, 0xc0}},
+    // sAave, yvCurve-sAave, 0xb4D1Be44BfF40ad6e506edf43156577a3f8672eC
+    {{0xb4, 0xd1, 0xbe, 0x44, 0xbf, 0xf4, 0x0a, 0xd6, 0xe5, 0x06,
+      0xed, 0xf4, 0x31, 0x56, 0x57, 0x7a, 0x3f, 0x86, 0x72, 0xec},
+     337,
+     337,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x28, 0xa0, 0x00, 0x00, 0x01}},
+    // 1INCH, yv1INCH, 0xB8C3B7A2A618C552C23B1E4701109a9E756Bab67
+    {{0xb8, 0xc3, 0xb7, 0xa2, 0xa6, 0x18, 0xc5, 0x52, 0xc2, 0x3b,
+      0x1e, 0x47, 0x01, 0x10, 0x9a, 0x9e, 0x75, 0x6b, 0xab, 0x67},
+     343,
+     343,
+     VAULT_PREFIX_YV,
+     18,
+     {0xaa, 0x88, 0x94, 0x01, 0x10}},
+    // crvEURTUSD, yvCurve-EURTUSD, 0xBCBB5b54Fa51e7b7Dc920340043B203447842A6b
+    {{0xbc, 0xbb, 0x5b, 0x54, 0xfa, 0x51, 0xe7, 0xb7, 0xdc, 0x92,
+      0x03, 0x40, 0x04, 0x3b, 0x20, 0x34, 0x47, 0x84, 0x2a, 0x6b},
+     349,
+     360,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0xf0, 0x80, 0x80, 0x10, 0x04}},
+    // USDC, yvUSDC-1, 0xBe53A109B494E5c9f97b9Cd39Fe969BE68BF6204
+    {{0xbe, 0x53, 0xa1, 0x09, 0xb4, 0x94, 0xe5, 0xc9, 0xf9, 0x7b,
+      0x9c, 0xd3, 0x9f, 0xe9, 0x69, 0xbe, 0x68, 0xbf, 0x62, 0x04},
+     187,
+     368,
+     VAULT_PREFIX_YV,
+     6,
+     {0x88, 0x88, 0x04, 0x43, 0x30}},
+    // DAI, yvDAI, 0xBFa4D8AA6d8a379aBFe7793399D3DdaCC5bBECBB
+    {{0xbf, 0xa4, 0xd8, 0xaa, 0x6d, 0x8a, 0x37, 0x9a, 0xbf, 0xe7,
+      0x79, 0x33, 0x99, 0xd3, 0xdd, 0xac, 0xc5, 0xbb, 0xec, 0xbb},
+     46,
+     46,
+     VAULT_PREFIX_YV,
+     18,
+     {0xcb, 0x00, 0xc0, 0x29, 0x9f}},
+    // rETH, yvCurve-rETH, 0xBfedbcbe27171C418CDabC2477042554b1904857
+    {{0xbf, 0xed, 0xbc, 0xbe, 0x27, 0x17, 0x1c, 0x41, 0x8c, 0xda,
+      0xbc, 0x24, 0x77, 0x04, 0x25, 0x54, 0xb1, 0x90, 0x48, 0x57},
+     375,
+     375,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x80, 0x04, 0x64, 0x00, 0x00}},
+    // RSV, yvCurve-RSV, 0xC116dF49c02c5fD147DE25Baa105322ebF26Bd97
+    {{0xc1, 0x16, 0xdf, 0x49, 0xc0, 0x2c, 0x5f, 0xd1, 0x47, 0xde,
+      0x25, 0xba, 0xa1, 0x05, 0x32, 0x2e, 0xbf, 0x26, 0xbd, 0x97},
+     380,
+     380,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x84, 0x02, 0x32, 0x00, 0x48}},
+    // USDP, yvCurve-USDP, 0xC4dAf3b5e2A9e93861c3FBDd25f1e943B8D87417
+    {{0xc4, 0xda, 0xf3, 0xb5, 0xe2, 0xa9, 0xe9, 0x38, 0x61, 0xc3,
+      0xfb, 0xdd, 0x25, 0xf1, 0xe9, 0x43, 0xb8, 0xd8, 0x74, 0x17},
+     384,
+     384,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x90, 0x20, 0x0e, 0x00, 0xa0}},
+    // CRV, yveCRV, 0xc5bDdf9843308380375a611c18B50Fb9341f502A
+    {{0xc5, 0xbd, 0xdf, 0x98, 0x43, 0x30, 0x83, 0x80, 0x37, 0x5a,
+      0x61, 0x1c, 0x18, 0xb5, 0x0f, 0xb9, 0x34, 0x1f, 0x50, 0x2a},
+     389,
+     393,
+     VAULT_PREFIX_YV,
+     18,
+     {0x10, 0x00, 0x00, 0x24, 0x01}},
+    // WBTC, yvWBTC, 0xcB550A6D4C8e3517A939BC79d0c7093eb7cF56B5
+    {{0xcb, 0x55, 0x0a, 0x6d, 0x4c, 0x8e, 0x35, 0x17, 0xa9, 0x39,
+      0xbc, 0x79, 0xd0, 0xc7, 0x09, 0x3e, 0xb7, 0xcf, 0x56, 0xb5},
+     321,
+     321,
+     VAULT_PREFIX_YV,
+     8,
+     {0x45, 0x40, 0x8c, 0x00, 0x12}},
+    // COMP, yvCurve-Compound, 0xD6Ea40597Be05c201845c0bFd2e96A60bACde267
+    {{0xd6, 0xea, 0x40, 0x59, 0x7b, 0xe0, 0x5c, 0x20, 0x18, 0x45,
+      0xc0, 0xbf, 0xd2, 0xe9, 0x6a, 0x60, 0xba, 0xcd, 0xe2, 0x67},
+     146,
+     398,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0xa0, 0x40, 0x01, 0x04, 0x60}},
+    // MIMUST, yvCurve-MIMUST, 0xd8C620991b8E626C099eAaB29B1E3eEa279763bb
+    {{0xd8, 0xc6, 0x20, 0x99, 0x1b, 0x8e, 0x62, 0x6c, 0x09, 0x9e,
+      0xaa, 0xb2, 0x9b, 0x1e, 0x3e, 0xea, 0x27, 0x97, 0x63, 0xbb},
+     407,
+     407,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x20, 0x11, 0x0a, 0x52, 0x00}},
+    // AAVE, yvAAVE, 0xd9788f3931Ede4D5018184E198699dC6d66C1915
+    {{0xd9, 0x78, 0x8f, 0x39, 0x31, 0xed, 0xe4, 0xd5, 0x01, 0x81,
+      0x84, 0xe1, 0x98, 0x69, 0x9d, 0xc6, 0xd6, 0x6c, 0x19, 0x15},
+     414,
+     414,
+     VAULT_PREFIX_YV,
+     18,
+     {0x00, 0x22, 0x02, 0x02, 0x10}},
+    // Pickle SLP, pSLPyvBOOST-ETH, 0xDA481b277dCe305B97F4091bD66595d57CF31634
+    {{0xda, 0x48, 0x1b, 0x27, 0x7d, 0xce, 0x30, 0x5b, 0x97, 0xf4,
+      0x09, 0x1b, 0xd6, 0x65, 0x95, 0xd5, 0x7c, 0xf3, 0x16, 0x34},
+     419,
+     430,
+     VAULT_PREFIX_NONE,
+     18,
+     {0xc0, 0x21, 0x20, 0x80, 0x60}},
+    // DAI, yvDAI, 0xdA816459F1AB5631232FE5e97a05BBBb94970c95
+    {{0xda, 0x81, 0x64, 0x59, 0xf1, 0xab, 0x56, 0x31, 0x23, 0x2f,
+      0xe5, 0xe9, 0x7a, 0x05, 0xbb, 0xbb, 0x94, 0x97, 0x0c, 0x95},
+     46,
+     46,
+     VAULT_PREFIX_YV,
+     18,
+     {0x40, 0xb0, 0x18, 0x0e, 0x00}},
+    // YFI, yvYFI, 0xdb25cA703181E7484a155DD612b06f57E12Be5F0
+    {{0xdb, 0x25, 0xca, 0x70, 0x31, 0x81, 0xe7, 0x48, 0x4a, 0x15,
+      0x5d, 0xd6, 0x12, 0xb0, 0x6f, 0x57, 0xe1, 0x2b, 0xe5, 0xf0},
+     446,
+     446,
+     VAULT_PREFIX_YV,
+     18,
+     {0x04, 0x08, 0x06, 0x00, 0x92}},
+    // stETH, yvCurve-stETH, 0xdCD90C7f6324cfa40d7169ef80b12031770B4325
+    {{0xdc, 0xd9, 0x0c, 0x7f, 0x63, 0x24, 0xcf, 0xa4, 0x0d, 0x71,
+      0x69, 0xef, 0x80, 0xb1, 0x20, 0x31, 0x77, 0x0b, 0x43, 0x25},
+     450,
+     450,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x64, 0x00, 0x00, 0x00, 0x10}},
+    // HEGIC, yvHEGIC, 0xe11ba472F74869176652C35D30dB89854b5ae84D
+    {{0xe1, 0x1b, 0xa4, 0x72, 0xf7, 0x48, 0x69, 0x17, 0x66, 0x52,
+      0xc3, 0x5d, 0x30, 0xdb, 0x89, 0x85, 0x4b, 0x5a, 0xe8, 0x4d},
+     456,
+     456,
+     VAULT_PREFIX_YV,
+     18,
+     {0x00, 0x80, 0x09, 0x10, 0x01}},
+    // YFI, yvYFI, 0xE14d13d8B3b85aF791b2AADD661cDBd5E6097Db1
+    {{0xe1, 0x4d, 0x13, 0xd8, 0xb3, 0xb8, 0x5a, 0xf7, 0x91, 0xb2,
+      0xaa, 0xdd, 0x66, 0x1c, 0xdb, 0xd5, 0xe6, 0x09, 0x7d, 0xb1},
+     446,
+     446,
+     VAULT_PREFIX_YV,
+     18,
+     {0x80, 0x82, 0x0f, 0x0c, 0x84}},
+    // USDC, yvUSDC, 0xe2F6b9773BF3A015E2aA70741Bde1498bdB9425b
+    {{0xe2, 0xf6, 0xb9, 0x77, 0x3b, 0xf3, 0xa0, 0x15, 0xe2, 0xaa,
+      0x70, 0x74, 0x1b, 0xde, 0x14, 0x98, 0xbd, 0xb9, 0x42, 0x5b},
+     187,
+     187,
+     VAULT_PREFIX_YV,
+     6,
+     {0x20, 0x68, 0x90, 0x40, 0x20}},
+    // 3Crypto, yvCurve-3Crypto, 0xE537B5cc158EB71037D4125BDD7538421981E6AA
+    {{0xe5, 0x37, 0xb5, 0xcc, 0x15, 0x8e, 0xb7, 0x10, 0x37, 0xd4,
+      0x12, 0x5b, 0xdd, 0x75, 0x38, 0x42, 0x19, 0x81, 0xe6, 0xaa},
+     462,
+     462,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x88, 0x18, 0x21, 0xc0, 0x0b}},
+    // oBTC, yvCurve-oBTC, 0xe9Dc63083c464d6EDcCFf23444fF3CFc6886f6FB
+    {{0xe9, 0xdc, 0x63, 0x08, 0x3c, 0x46, 0x4d, 0x6e, 0xdc, 0xcf,
+      0xf2, 0x34, 0x44, 0xff, 0x3c, 0xfc, 0x68, 0x86, 0xf6, 0xfb},
+     470,
+     470,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x20, 0x01, 0xb0, 0x16, 0x03}},
+    // SNX, yvSNX, 0xF29AE508698bDeF169B89834F76704C3B205aedf
+    {{0xf2, 0x9a, 0xe5, 0x08, 0x69, 0x8b, 0xde, 0xf1, 0x69, 0xb8,
+      0x98, 0x34, 0xf7, 0x67, 0x04, 0xc3, 0xb2, 0x05, 0xae, 0xdf},
+     475,
+     475,
+     VAULT_PREFIX_YV,
+     18,
+     {0x98, 0x0a, 0x20, 0x82, 0x80}},
+    // LINK, yvCurve-LINK, 0xf2db9a7c0ACd427A680D640F02d90f6186E71725
+    {{0xf2, 0xdb, 0x9a, 0x7c, 0x0a, 0xcd, 0x42, 0x7a, 0x68, 0x0d,
+      0x64, 0x0f, 0x02, 0xd9, 0x0f, 0x61, 0x86, 0xe7, 0x17, 0x25},
+     197,
+     197,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x61, 0x11, 0x00, 0x20}},
+    // OUSD3CRV-f, yvCurve-OUSD, 0xF59D66c1d593Fb10e2f8c2a6fD2C958792434B9c
+    {{0xf5, 0x9d, 0x66, 0xc1, 0xd5, 0x93, 0xfb, 0x10, 0xe2, 0xf8,
+      0xc2, 0xa6, 0xfd, 0x2c, 0x95, 0x87, 0x92, 0x43, 0x4b, 0x9c},
+     479,
+     490,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x90, 0x08, 0x00, 0x50, 0x04}},
+    // TUSD, yvCurve-TUSD, 0xf8768814b88281DE4F532a3beEfA5b85B69b9324
+    {{0xf8, 0x76, 0x88, 0x14, 0xb8, 0x82, 0x81, 0xde, 0x4f, 0x53,
+      0x2a, 0x3b, 0xee, 0xfa, 0x5b, 0x85, 0xb6, 0x9b, 0x93, 0x24},
+     495,
+     495,
+     VAULT_PREFIX_YVCURVE,
+     18,
+     {0x00, 0x03, 0x40, 0x50, 0x80}},
+    // UNI, yvUNI, 0xFBEB78a723b8087fD2ea7Ef1afEc93d35E8Bed42
+    {{0xfb, 0xeb, 0x78, 0xa7, 0x23, 0xb8, 0x08, 0x7f, 0xd2, 0xea,
+      0x7e, 0xf1, 0xaf, 0xec, 0x93, 0xd3, 0x5e, 0x8b, 0xed, 0x42},
+     500,
+     500,
+     VAULT_PREFIX_YV,
+     18,
+     {0xf0, 0x00, 0x84, 0x20, 0x50}},
+    // TUSD, yvTUSD, 0xFD0877d9095789cAF24c98F7CCe092fa8E120775
+    {{0xfd, 0x08, 0x77, 0xd9, 0x09, 0x57, 0x89, 0xca, 0xf2, 0x4c,
+      0x98, 0xf7, 0xcc, 0xe0, 0x92, 0xfa, 0x8e, 0x12, 0x07, 0x75},
+     495,
+     495,
+     VAULT_PREFIX_YV,
+     18,
+     {0xc0, 0x01, 0x82, 0xc0, 0x40}}};
+
+// Sorted by address, see `find_vault_index`.
+static const yearnVaultDefinition_t IRON_BANK_ETHEREUM[32] = {
+    // EUR, cyEUR, 0x00e5c0774A5F065c285068170b20393925C84BF3
+    {{0x00, 0xe5, 0xc0, 0x77, 0x4a, 0x5f, 0x06, 0x5c, 0x28, 0x50,
+      0x68, 0x17, 0x0b, 0x20, 0x39, 0x39, 0x25, 0xc8, 0x4b, 0xf3},
+     504,
+     504,
+     VAULT_PREFIX_CY,
+     18,
+     {0x00, 0x50, 0x00, 0x00, 0x26}},
+    // BUSD, cyBUSD, 0x09bDCCe2593f0BEF0991188c25Fb744897B6572d
+    {{0x09, 0xbd, 0xcc, 0xe2, 0x59, 0x3f, 0x0b, 0xef, 0x09, 0x91,
+      0x18, 0x8c, 0x25, 0xfb, 0x74, 0x48, 0x97, 0xb6, 0x57, 0x2d},
+     214,
+     214,
+     VAULT_PREFIX_CY,
+     18,
+     {0x1c, 0x07, 0x00, 0x20, 0x20}},
+    // SNX, cySNX, 0x12A9cC33A980DAa74E00cc2d1A0E74C57A93d12C
+    {{0x12, 0xa9, 0xcc, 0x33, 0xa9, 0x80, 0xda, 0xa7, 0x4e, 0x00,
+      0xcc, 0x2d, 0x1a, 0x0e, 0x74, 0xc5, 0x7a, 0x93, 0xd1, 0x2c},
+     475,
+     475,
+     VAULT_PREFIX_CY,
+     18,
+     {0x24, 0x8c, 0x40, 0x52, 0x41}},
+    // CHF, cyCHF, 0x1b3E95E8ECF7A7caB6c4De1b344F94865aBD12d5
+    {{0x1b, 0x3e, 0x95, 0xe8, 0xec, 0xf7, 0xa7, 0xca, 0xb6, 0xc4,
+      0xde, 0x1b, 0x34, 0x4f, 0x94, 0x86, 0x5a, 0xbd, 0x12, 0xd5},
+     508,
+     508,
+     VAULT_PREFIX_CY,
+     18,
+     {0x12, 0xe8, 0x88, 0x10, 0x30}},
+    // JPY, cyJPY, 0x215F34af6557A6598DbdA9aa11cc556F5AE264B1
+    {{0x21, 0x5f, 0x34, 0xaf, 0x65, 0x57, 0xa6, 0x59, 0x8d, 0xbd,
+      0xa9, 0xaa, 0x11, 0xcc, 0x55, 0x6f, 0x5a, 0xe2, 0x64, 0xb1},
+     512,
+     512,
+     VAULT_PREFIX_CY,
+     18,
+     {0x10, 0x08, 0x48, 0x01, 0x62}},
+    // SUSHI, cySUSHI, 0x226F3738238932BA0dB2319a8117D9555446102f
+    {{0x22, 0x6f, 0x37, 0x38, 0x23, 0x89, 0x32, 0xba, 0x0d, 0xb2,
+      0x31, 0x9a, 0x81, 0x17, 0xd9, 0x55, 0x54, 0x46, 0x10, 0x2f},
+     208,
+     208,
+     VAULT_PREFIX_CY,
+     18,
+     {0x10, 0x03, 0x20, 0x08, 0x00}},
+    // DUSD, cyDUSD, 0x297d4Da727fbC629252845E96538FC46167e453A
+    {{0x29, 0x7d, 0x4d, 0xa7, 0x27, 0xfb, 0xc6, 0x29, 0x25, 0x28,
+      0x45, 0xe9, 0x65, 0x38, 0xfc, 0x46, 0x16, 0x7e, 0x45, 0x3a},
+     93,
+     93,
+     VAULT_PREFIX_CY,
+     18,
+     {0x04, 0x08, 0x02, 0x0c, 0x01}},
+    // AAVE, cyAAVE, 0x30190a3B52b5AB1daF70D46D72536F5171f22340
+    {{0x30, 0x19, 0x0a, 0x3b, 0x52, 0xb5, 0xab, 0x1d, 0xaf, 0x70,
+      0xd4, 0x6d, 0x72, 0x53, 0x6f, 0x51, 0x71, 0xf2, 0x23, 0x40},
+     414,
+     414,
+     VAULT_PREFIX_CY,
+     18,
+     {0x01, 0x0c, 0x49, 0x04, 0x00}},
+    // KRW, cyKRW, 0x3c9f5385c288cE438Ed55620938A4B967c080101
+    {{0x3c, 0x9f, 0x53, 0x85, 0xc2, 0x88, 0xce, 0x43, 0x8e, 0xd5,
+      0x56, 0x20, 0x93, 0x8a, 0x4b, 0x96, 0x7c, 0x08, 0x01, 0x01},
+     516,
+     516,
+     VAULT_PREFIX_CY,
+     18,
+     {0x00, 0x04, 0x40, 0x14, 0x00}},
+    // WETH, cyWETH, 0x41c84c0e2EE0b740Cf0d31F63f3B6F627DC6b393
+    {{0x41, 0xc8, 0x4c, 0x0e, 0x2e, 0xe0, 0xb7, 0x40, 0xcf, 0x0d,
+      0x31, 0xf6, 0x3f, 0x3b, 0x6f, 0x62, 0x7d, 0xc6, 0xb3, 0x93},
+     316,
+     316,
+     VAULT_PREFIX_CY,
+     18,
+     {0x00, 0x60, 0x82, 0x14, 0x60}},
+    // USDT, cyUSDT, 0x48759F220ED983dB51fA7A8C0D2AAb8f3ce4166a
+    {{0x48, 0x75, 0x9f, 0x22, 0x0e, 0xd9, 0x83, 0xdb, 0x51, 0xfa,
+      0x7a, 0x8c, 0x0d, 0x2a, 0xab, 0x8f, 0x3c, 0xe4, 0x16, 0x6a},
+     79,
+     79,
+     VAULT_PREFIX_CY,
+     6,
+     {0x04, 0x61, 0x15, 0x58, 0x00}},
+    // CDAI, cyCDAI, 0x4F12c9DABB5319A252463E6028CA833f1164d045
+    {{0x4f, 0x12, 0xc9, 0xda, 0xbb, 0x53, 0x19, 0xa2, 0x52, 0x46,
+      0x3e, 0x60, 0x28, 0xca, 0x83, 0x3f, 0x11, 0x64, 0xd0, 0x45},
+     520,
+     520,
+     VAULT_PREFIX_CY,
+     18,
+     {0x43, 0xc2, 0x04, 0x30, 0x00}},
+    // ZAR, cyZAR, 0x672473908587b10e65DAB177Dbaeadcbb30BF40B
+    {{0x67, 0x24, 0x73, 0x90, 0x85, 0x87, 0xb1, 0x0e, 0x65, 0xda,
+      0xb1, 0x77, 0xdb, 0xae, 0xad, 0xcb, 0xb3, 0x0b, 0xf4, 0x0b},
+     525,
+     525,
+     VAULT_PREFIX_CY,
+     18,
+     {0x00, 0x00, 0x38, 0x80, 0x19}},
+    // Y3CRV, cyY3CRV, 0x7589C9E17BCFcE1Ccaa1f921196FDa177F0207Fc
+    {{0x75, 0x89, 0xc9, 0xe1, 0x7b, 0xcf, 0xce, 0x1c, 0xca, 0xa1,
+      0xf9, 0x21, 0x19, 0x6f, 0xda, 0x17, 0x7f, 0x02, 0x07, 0xfc},
+     529,
+     529,
+     VAULT_PREFIX_CY,
+     18,
+     {0x0a, 0x75, 0x00, 0x18, 0x42}},
+    // USDC, cyUSDC, 0x76Eb2FE28b36B3ee97F3Adae0C69606eeDB2A37c
+    {{0x76, 0xeb, 0x2f, 0xe2, 0x8b, 0x36, 0xb3, 0xee, 0x97, 0xf3,
+      0xad, 0xae, 0x0c, 0x69, 0x60, 0x6e, 0xed, 0xb2, 0xa3, 0x7c},
+     187,
+     187,
+     VAULT_PREFIX_CY,
+     6,
+     {0x26, 0x08, 0x28, 0x40, 0x68}},
+    // DPI, cyDPI, 0x7736Ffb07104c0C400Bb0CC9A7C228452A732992
+    {{0x77, 0x36, 0xff, 0xb0, 0x71, 0x04, 0xc0, 0xc4, 0x00, 0xbb,
+      0x0c, 0xc9, 0xa7, 0xc2, 0x28, 0x45, 0x2a, 0x73, 0x29, 0x92},
+     535,
+     535,
+     VAULT_PREFIX_CY,
+     18,
+     {0x08, 0x02, 0x26, 0xa0, 0x40}},
+    // AUD, cyAUD, 0x86BBD9ac8B9B44C95FFc6BAAe58E25033B7548AA
+    {{0x86, 0xbb, 0xd9, 0xac, 0x8b, 0x9b, 0x44, 0xc9, 0x5f, 0xfc,
+      0x6b, 0xaa, 0xe5, 0x8e, 0x25, 0x03, 0x3b, 0x75, 0x48, 0xaa},
+     539,
+     539,
+     VAULT_PREFIX_CY,
+     18,
+     {0x38, 0x52, 0x67, 0x10, 0x43}},
+    // DAI, cyDAI, 0x8e595470Ed749b85C6F7669de83EAe304C2ec68F
+    {{0x8e, 0x59, 0x54, 0x70, 0xed, 0x74, 0x9b, 0x85, 0xc6, 0xf7,
+      0x66, 0x9d, 0xe8, 0x3e, 0xae, 0x30, 0x4c, 0x2e, 0xc6, 0x8f},
+     46,
+     46,
+     VAULT_PREFIX_CY,
+     18,
+     {0x00, 0x80, 0xa0, 0x18, 0x41}},
+    // WBTC, cyWBTC, 0x8Fc8BFD80d6A9F17Fb98A373023d72531792B431
+    {{0x8f, 0xc8, 0xbf, 0xd8, 0x0d, 0x6a, 0x9f, 0x17, 0xfb, 0x98,
+      0xa3, 0x73, 0x02, 0x3d, 0x72, 0x53, 0x17, 0x92, 0xb4, 0x31},
+     321,
+     321,
+     VAULT_PREFIX_CY,
+     8,
+     {0x4e, 0x14, 0x88, 0x00, 0x08}},
+    // CUSDC, cyCUSDC, 0x950027632FbD6aDAdFe82644BfB64647642B6C09
+    {{0x95, 0x00, 0x27, 0x63, 0x2f, 0xbd, 0x6a, 0xda, 0xdf, 0xe8,
+      0x26, 0x44, 0xbf, 0xb6, 0x46, 0x47, 0x64, 0x2b, 0x6c, 0x09},
+     543,
+     543,
+     VAULT_PREFIX_CY,
+     8,
+     {0x00, 0x53, 0x40, 0xa0, 0x14}},
+    // CREAM, cyCREAM, 0x9D029CD7CEdcB194E2C361948f279f1788135BB2
+    {{0x9d, 0x02, 0x9c, 0xd7, 0xce, 0xdc, 0xb1, 0x94, 0xe2, 0xc3,
+      0x61, 0x94, 0x8f, 0x27, 0x9f, 0x17, 0x88, 0x13, 0x5b, 0xb2},
+     549,
+     549,
+     VAULT_PREFIX_CY,
+     18,
+     {0x46, 0xc8, 0xa0, 0x00, 0x06}},
+    // MIM, cyMIM, 0x9e8E207083ffd5BDc3D99A1F32D1e6250869C1A9
+    {{0x9e, 0x8e, 0x20, 0x70, 0x83, 0xff, 0xd5, 0xbd, 0xc3, 0xd9,
+      0x9a, 0x1f, 0x32, 0xd1, 0xe6, 0x25, 0x08, 0x69, 0xc1, 0xa9},
+     89,
+     89,
+     VAULT_PREFIX_CY,
+     18,
+     {0x10, 0x03, 0x25, 0x20, 0x0a}},
+    // SUSD, cySUSD, 0xa7c4054AFD3DbBbF5bFe80f41862b89ea05c9806
+    {{0xa7, 0xc4, 0x05, 0x4a, 0xfd, 0x3d, 0xbb, 0xbf, 0x5b, 0xfe,
+      0x80, 0xf4, 0x18, 0x62, 0xb8, 0x9e, 0xa0, 0x5c, 0x98, 0x06},
+     555,
+     555,
+     VAULT_PREFIX_CY,
+     18,
+     {0x01, 0xd5, 0x20, 0x00, 0x00}},
+    // EURS, cyEURS, 0xA8caeA564811af0e92b1E044f3eDd18Fa9a73E4F
+    {{0xa8, 0xca, 0xea, 0x56, 0x48, 0x11, 0xaf, 0x0e, 0x92, 0xb1,
+      0xe0, 0x44, 0xf3, 0xed, 0xd1, 0x8f, 0xa9, 0xa7, 0x3e, 0x4f},
+     65,
+     65,
+     VAULT_PREFIX_CY,
+     2,
+     {0x84, 0x00, 0x08, 0x11, 0x05}},
+    // CRV, cyCRV, 0xB8c5af54bbDCc61453144CF472A9276aE36109F9
+    {{0xb8, 0xc5, 0xaf, 0x54, 0xbb, 0xdc, 0xc6, 0x14, 0x53, 0x14,
+      0x4c, 0xf4, 0x72, 0xa9, 0x27, 0x6a, 0xe3, 0x61, 0x09, 0xf9},
+     389,
+     389,
+     VAULT_PREFIX_CY,
+     18,
+     {0x80, 0x30, 0x06, 0x20, 0x82}},
+    // CUSDT, cyCUSDT, 0xBB4B067cc612494914A902217CB6078aB4728E36
+    {{0xbb, 0x4b, 0x06, 0x7c, 0xc6, 0x12, 0x49, 0x49, 0x14, 0xa9,
+      0x02, 0x21, 0x7c, 0xb6, 0x07, 0x8a, 0xb4, 0x72, 0x8e, 0x36},
+     560,
+     560,
+     VAULT_PREFIX_CY,
+     8,
+     {0xd0, 0x00, 0x20, 0x60, 0x84}},
+    // MUSD, cyMUSD, 0xBE86e8918DFc7d3Cb10d295fc220F941A1470C5c
+    {{0xbe, 0x86, 0xe8, 0x91, 0x8d, 0xfc, 0x7d, 0x3c, 0xb1, 0x0d,
+      0x29, 0x5f, 0xc2, 0x20, 0xf9, 0x41, 0xa1, 0x47, 0x0c, 0x5c},
+     566,
+     566,
+     VAULT_PREFIX_CY,
+     18,
+     {0xc0, 0x61, 0x00, 0x08, 0x84}},
+    // SEUR, cySEUR, 0xCA55F9C4E77f7B8524178583b0f7c798De17fD54
+    {{0xca, 0x55, 0xf9, 0xc4, 0xe7, 0x7f, 0x7b, 0x85, 0x24, 0x17,
+      0x85, 0x83, 0xb0, 0xf7, 0xc7, 0x98, 0xde, 0x17, 0xfd, 0x54},
+     571,
+     571,
+     VAULT_PREFIX_CY,
+     18,
+     {0xca, 0x84, 0x00, 0x00, 0x84}},
+    // LINK, cyLINK, 0xE7BFf2Da8A2f619c2586FB83938Fa56CE803aA16
+    {{0xe7, 0xbf, 0xf2, 0xda, 0x8a, 0x2f, 0x61, 0x9c, 0x25, 0x86,
+      0xfb, 0x83, 0x93, 0x8f, 0xa5, 0x6c, 0xe8, 0x03, 0xaa, 0x16},
+     197,
+     197,
+     VAULT_PREFIX_CY,
+     18,
+     {0xb2, 0x40, 0x0c, 0x11, 0x84}},
+    // GBP, cyGBP, 0xecaB2C76f1A8359A06fAB5fA0CEea51280A97eCF
+    {{0xec, 0xab, 0x2c, 0x76, 0xf1, 0xa8, 0x35, 0x9a, 0x06, 0xfa,
+      0xb5, 0xfa, 0x0c, 0xee, 0xa5, 0x12, 0x80, 0xa9, 0x7e, 0xcf},
+     576,
+     576,
+     VAULT_PREFIX_CY,
+     18,
+     {0x14, 0x21, 0x19, 0x60, 0x23}},
+    // YFI, cyYFI, 0xFa3472f7319477c9bFEcdD66E4B948569E7621b9
+    {{0xfa, 0x34, 0x72, 0xf7, 0x31, 0x94, 0x77, 0xc9, 0xbf, 0xec,
+      0xdd, 0x66, 0xe4, 0xb9, 0x48, 0x56, 0x9e, 0x76, 0x21, 0xb9},
+     446,
+     446,
+     VAULT_PREFIX_CY,
+     18,
+     {0x80, 0x00, 0x64, 0xa0, 0x40}},
+    // UNI, cyUNI, 0xFEEB92386A055E2eF7C2B598c872a4047a7dB59F
+    {{0xfe, 0xeb, 0x92, 0x38, 0x6a, 0x05, 0x5e, 0x2e, 0xf7, 0xc2,
+      0xb5, 0x98, 0xc8, 0x72, 0xa4, 0x04, 0x7a, 0x7d, 0xb5, 0x9f},
+     500,
+     500,
+     VAULT_PREFIX_CY,
+     18,
+     {0xf0, 0x44, 0xa8, 0x00, 0x09}}};
+
+// Sorted by address, see `get_zap_token`.
+static const zapTokenDefinition_t ZAP_TOKENS_ETHEREUM[5] = {
+    // WBTC, 0x2260FAC5E5542a773Aa44fBCfeDf7C193bc2C599
+    {{0x22, 0x60, 0xfa, 0xc5, 0xe5, 0x54, 0x2a, 0x77, 0x3a, 0xa4,
+      0x4f, 0xbc, 0xfe, 0xdf, 0x7c, 0x19, 0x3b, 0xc2, 0xc5, 0x99},
+     321,
+     8},
+    // DAI, 0x6B175474E89094C44Da98b954EedeAC495271d0F
+    {{0x6b, 0x17, 0x54, 0x74, 0xe8, 0x90, 0x94, 0xc4, 0x4d, 0xa9,
+      0x8b, 0x95, 0x4e, 0xed, 0xea, 0xc4, 0x95, 0x27, 0x1d, 0x0f},
+     46,
+     18},
+    // USDC, 0xA0b86991c6218b36c1d19D4a2e9Eb0cE3606eB48
+    {{0xa0, 0xb8, 0x69, 0x91, 0xc6, 0x21, 0x8b, 0x36, 0xc1, 0xd1,
+      0x9d, 0x4a, 0x2e, 0x9e, 0xb0, 0xce, 0x36, 0x06, 0xeb, 0x48},
+     187,
+     6},
+    // WETH, 0xC02aaA39b223FE8D0A0e5C4F27eAD9083C756Cc2
+    {{0xc0, 0x2a, 0xaa, 0x39, 0xb2, 0x23, 0xfe, 0x8d, 0x0a, 0x0e,
+      0x5c, 0x4f, 0x27, 0xea, 0xd9, 0x08, 0x3c, 0x75, 0x6c, 0xc2},
+     316,
+     18},
+    // USDT, 0xdAC17F958D2ee523a2206206994597C13D831ec7
+    {{0xda, 0xc1, 0x7f, 0x95, 0x8d, 0x2e, 0xe5, 0x23, 0xa2, 0x20,
+      0x62, 0x06, 0x99, 0x45, 0x97, 0xc1, 0x3d, 0x83, 0x1e, 0xc7},
+     79,
+     6}};
+
+// Sorted by address, see `find_vault_index`.
+static const yearnVaultDefinition_t YEARN_VAULTS_FANTOM[1] = {
+    // WFTM, yvWFTM, 0x0DEC85e74A92c52b7F708c4B10207D9560CEFaf0
+    {{0x0d, 0xec, 0x85, 0xe7, 0x4a, 0x92, 0xc5, 0x2b, 0x7f, 0x70,
+      0x8c, 0x4b, 0x10, 0x20, 0x7d, 0x95, 0x60, 0xce, 0xfa, 0xf0},
+     580,
+     580,
+     VAULT_PREFIX_YV,
+     18,
+     {0x70, 0x40, 0x41, 0x04, 0x38}}};
+
+// Vault and zap token tables of each chain, see `find_chain_index`.
+const chain_t CHAINS[NUM_CHAINS] = {
+    // ethereum
+    {1, YEARN_VAULTS_ETHEREUM, IRON_BANK_ETHEREUM, ZAP_TOKENS_ETHEREUM, 86, 32, 5, 585},
+    // fantom
+    {250, YEARN_VAULTS_FANTOM, NULL, NULL, 1, 0, 0, 589}};
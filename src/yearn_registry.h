@@ -0,0 +1,49 @@
+// Generated by tools/gen_registry.py from registry/yearn.json, do not edit.
+#pragma once
+
+#define NUM_SELECTORS      26
+#define NUM_CHAINS         2
+#define MAX_TABLE_SIZE     86
+#define NUM_VAULT_PREFIXES 4
+#define MAX_PARAMS         4
+#define MAX_SCREENS        4
+#define TICKER_POOL_SIZE   593
+#define NUM_DESTINATIONS   122
+
+// Enumeration of the different selectors possible, in the order of YEARN_SELECTORS.
+typedef enum {
+    DEPOSIT_ALL,
+    DEPOSIT,
+    DEPOSIT_TO,
+    WITHDRAW_ALL,
+    WITHDRAW,
+    WITHDRAW_TO,
+    WITHDRAW_TO_SLIPPAGE,
+    ERC4626_MINT,
+    ERC4626_WITHDRAW,
+    ERC4626_REDEEM,
+    ZAP_IN,
+    ZAP_IN_PICKLE,
+    IB_MINT,
+    IB_REDEEM,
+    IB_REDEEM_UNDERLYING,
+    IB_BORROW,
+    IB_REPAY_BORROW,
+    ROUTER_DEPOSIT,
+    ROUTER_MINT,
+    ROUTER_WITHDRAW,
+    ROUTER_REDEEM,
+    MULTICALL,
+    CLAIM,
+    EXIT,
+    GET_REWARDS,
+    DEPOSIT_ALL_YVECRV,
+} selector_t;
+
+// Prefix of a vault name, in the order of VAULT_PREFIXES.
+typedef enum {
+    VAULT_PREFIX_NONE,     // ""
+    VAULT_PREFIX_YVCURVE,  // "yvCurve-"
+    VAULT_PREFIX_YV,       // "yv"
+    VAULT_PREFIX_CY,       // "cy"
+} vault_prefix_t;
@@ -5,6 +5,9 @@ NANOS_SDK=$NANOS_SDK
 NANOX_SDK=$NANOX_SDK
 APP_ETHEREUM=/plugin_dev/app-ethereum
 
+# The plugin is built with the registry: run the tests with NVM_REGISTRY=1 to include
+# src/registry_update.test.js.
+
 # create elfs folder if it doesn't exist
 mkdir -p elfs
 
@@ -15,7 +18,7 @@ echo "*Building elfs for Nano S..."
 
 echo "**Building app-plugin for Nano S..."
 make clean BOLOS_SDK=$NANOS_SDK
-make -j DEBUG=1 BOLOS_SDK=$NANOS_SDK
+make -j DEBUG=1 NVM_REGISTRY=1 REGISTRY_TEST_KEY=1 BOLOS_SDK=$NANOS_SDK
 cp bin/app.elf "tests/elfs/plugin_nanos.elf"
 
 echo "**Building app-ethereum for Nano S..."
@@ -30,7 +33,7 @@ echo "*Building elfs for Nano X..."
 
 echo "**Building plugin for Nano X..."
 make clean BOLOS_SDK=$NANOX_SDK
-make -j DEBUG=1 BOLOS_SDK=$NANOX_SDK
+make -j DEBUG=1 NVM_REGISTRY=1 REGISTRY_TEST_KEY=1 BOLOS_SDK=$NANOX_SDK
 cp bin/app.elf "tests/elfs/plugin_nanox.elf"
 
 echo "**Building app-ethereum for Nano X..."
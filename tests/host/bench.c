@@ -0,0 +1,327 @@
+// Micro-benchmark of `dispatch_plugin_calls`: cost of every plugin message for each transaction of
+// vectors.c, in ns/call and, when the kernel allows it, in retired instructions/call.
+//
+//   make -C tests/host bench                       # all transactions
+//   ./tests/host/build/bench -n 20000 -f zap       # fewer iterations, names or families
+//   ./tests/host/build/bench -c > bench.csv        # CSV, to compare two builds
+//
+// Messages that change the context (PROVIDE_PARAMETER, FINALIZE, PROVIDE_INFO) are replayed
+// from a snapshot of the context taken just before them; the cost of restoring the snapshot is
+// measured separately and subtracted.
+#include <getopt.h>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "vectors.h"
+
+#define DEFAULT_ITERATIONS 100000
+#define MAX_WORDS          (HOST_MAX_CALLDATA / PARAMETER_LENGTH)
+#define BENCH_MAX_SCREENS  16
+
+typedef struct counters_t {
+    uint64_t ns;
+    uint64_t instructions;
+} counters_t;
+
+static int perf_fd = -1;
+
+static void perf_open(void) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    perf_fd = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (perf_fd < 0) {
+        fprintf(stderr, "perf_event_open failed, instructions/call not available\n");
+    }
+}
+
+static uint64_t perf_read(void) {
+    uint64_t value = 0;
+    if (perf_fd >= 0 && read(perf_fd, &value, sizeof(value)) != sizeof(value)) {
+        value = 0;
+    }
+    return value;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+static counters_t counters_start(void) {
+    counters_t start = {now_ns(), perf_read()};
+    return start;
+}
+
+static counters_t counters_since(counters_t start) {
+    uint64_t instructions = perf_read();
+    counters_t elapsed = {now_ns() - start.ns, instructions - start.instructions};
+    return elapsed;
+}
+
+typedef struct bench_t {
+    host_tx_t tx;
+    uint8_t calldata[HOST_MAX_CALLDATA];
+    size_t calldata_len;
+    size_t num_words;
+    ethPluginProvideParameter_t params[MAX_WORDS];
+    ethQueryContractUI_t queries[BENCH_MAX_SCREENS];
+    uint8_t after_init[PLUGIN_CONTEXT_SIZE];
+    uint8_t after_parameters[PLUGIN_CONTEXT_SIZE];
+    uint8_t after_finalize[PLUGIN_CONTEXT_SIZE];
+    ethPluginFinalize_t finalize;
+    counters_t restore;  // Cost of one `restore` call, subtracted from the stateful messages.
+    unsigned iterations;
+    bool csv;
+} bench_t;
+
+static void restore(bench_t *bench, const uint8_t *snapshot) {
+    memcpy(bench->tx.context, snapshot, PLUGIN_CONTEXT_SIZE);
+    // Keep the compiler from merging or dropping the copies.
+    __asm__ volatile("" : : "r"(bench->tx.context) : "memory");
+}
+
+static void report(const bench_t *bench,
+                   const host_vector_t *vector,
+                   const char *message,
+                   counters_t total,
+                   uint64_t calls,
+                   uint64_t restores) {
+    double ns = ((double) total.ns - (double) bench->restore.ns * restores) / calls;
+    double instructions = ((double) total.instructions -
+                           (double) bench->restore.instructions * restores) /
+                          calls;
+    if (bench->csv) {
+        printf("%s,%s,%s,%.2f,", vector->name, vector->family, message, ns);
+        perf_fd >= 0 ? printf("%.1f\n", instructions) : printf("\n");
+    } else {
+        printf("%-32s %-10s %-20s %10.2f", vector->name, vector->family, message, ns);
+        perf_fd >= 0 ? printf(" %12.1f\n", instructions) : printf(" %12s\n", "-");
+    }
+}
+
+// Measures the snapshot restore alone, in ns and instructions per call.
+static void measure_restore(bench_t *bench) {
+    counters_t start = counters_start();
+    for (unsigned i = 0; i < bench->iterations; i++) {
+        restore(bench, bench->after_init);
+    }
+    counters_t total = counters_since(start);
+    bench->restore.ns = total.ns / bench->iterations;
+    bench->restore.instructions = total.instructions / bench->iterations;
+}
+
+static bool run_vector(bench_t *bench, const host_vector_t *vector) {
+    host_tx_t *tx = &bench->tx;
+    ethPluginInitContract_t init;
+    ethPluginProvideInfo_t info;
+    ethQueryContractID_t query_id;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+    counters_t start;
+
+    if (!host_vector_load(vector,
+                          tx,
+                          bench->calldata,
+                          sizeof(bench->calldata),
+                          &bench->calldata_len)) {
+        fprintf(stderr, "%s: invalid vector\n", vector->name);
+        return false;
+    }
+    bench->num_words = (bench->calldata_len - SELECTOR_SIZE) / PARAMETER_LENGTH;
+    if (bench->calldata_len < SELECTOR_SIZE || bench->num_words > MAX_WORDS) {
+        fprintf(stderr, "%s: invalid calldata length\n", vector->name);
+        return false;
+    }
+
+    host_msg_init_contract(tx, &init, bench->calldata, bench->calldata_len);
+    start = counters_start();
+    for (unsigned i = 0; i < bench->iterations; i++) {
+        dispatch_plugin_calls(ETH_PLUGIN_INIT_CONTRACT, &init);
+    }
+    report(bench, vector, "INIT_CONTRACT", counters_since(start), bench->iterations, 0);
+    if (init.result != ETH_PLUGIN_RESULT_OK) {
+        fprintf(stderr, "%s: INIT_CONTRACT returned %d\n", vector->name, init.result);
+        return false;
+    }
+    memcpy(bench->after_init, tx->context, PLUGIN_CONTEXT_SIZE);
+    measure_restore(bench);
+
+    if (bench->num_words > 0) {
+        for (size_t word = 0; word < bench->num_words; word++) {
+            host_msg_provide_parameter(tx,
+                                       &bench->params[word],
+                                       bench->calldata,
+                                       SELECTOR_SIZE + word * PARAMETER_LENGTH);
+        }
+        start = counters_start();
+        for (unsigned i = 0; i < bench->iterations; i++) {
+            restore(bench, bench->after_init);
+            for (size_t word = 0; word < bench->num_words; word++) {
+                dispatch_plugin_calls(ETH_PLUGIN_PROVIDE_PARAMETER, &bench->params[word]);
+            }
+        }
+        report(bench,
+               vector,
+               "PROVIDE_PARAMETER",
+               counters_since(start),
+               (uint64_t) bench->iterations * bench->num_words,
+               bench->iterations);
+        for (size_t word = 0; word < bench->num_words; word++) {
+            if (bench->params[word].result != ETH_PLUGIN_RESULT_OK) {
+                fprintf(stderr,
+                        "%s: PROVIDE_PARAMETER returned %d\n",
+                        vector->name,
+                        bench->params[word].result);
+                return false;
+            }
+        }
+    }
+    memcpy(bench->after_parameters, tx->context, PLUGIN_CONTEXT_SIZE);
+
+    host_msg_finalize(tx, &bench->finalize);
+    start = counters_start();
+    for (unsigned i = 0; i < bench->iterations; i++) {
+        restore(bench, bench->after_parameters);
+        dispatch_plugin_calls(ETH_PLUGIN_FINALIZE, &bench->finalize);
+    }
+    report(bench, vector, "FINALIZE", counters_since(start), bench->iterations, bench->iterations);
+    if (bench->finalize.result != ETH_PLUGIN_RESULT_OK) {
+        fprintf(stderr, "%s: FINALIZE returned %d\n", vector->name, bench->finalize.result);
+        return false;
+    }
+    memcpy(bench->after_finalize, tx->context, PLUGIN_CONTEXT_SIZE);
+    uint8_t num_screens = bench->finalize.numScreens;
+
+    if (bench->finalize.tokenLookup1 != NULL || bench->finalize.tokenLookup2 != NULL) {
+        host_msg_provide_info(tx, &info, &bench->finalize);
+        start = counters_start();
+        for (unsigned i = 0; i < bench->iterations; i++) {
+            restore(bench, bench->after_finalize);
+            dispatch_plugin_calls(ETH_PLUGIN_PROVIDE_INFO, &info);
+        }
+        report(bench,
+               vector,
+               "PROVIDE_INFO",
+               counters_since(start),
+               bench->iterations,
+               bench->iterations);
+        num_screens += info.additionalScreens;
+    }
+
+    host_msg_query_id(tx, &query_id, title, sizeof(title), msg, sizeof(msg));
+    start = counters_start();
+    for (unsigned i = 0; i < bench->iterations; i++) {
+        dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_ID, &query_id);
+    }
+    report(bench, vector, "QUERY_CONTRACT_ID", counters_since(start), bench->iterations, 0);
+
+    // One call per screen, as when the user scrolls through the transaction once.
+    if (num_screens > BENCH_MAX_SCREENS) {
+        fprintf(stderr, "%s: too many screens (%d)\n", vector->name, num_screens);
+        return false;
+    }
+    for (uint8_t screen = 0; screen < num_screens; screen++) {
+        host_msg_query_ui(tx,
+                          &bench->queries[screen],
+                          screen,
+                          title,
+                          sizeof(title),
+                          msg,
+                          sizeof(msg));
+    }
+    start = counters_start();
+    for (unsigned i = 0; i < bench->iterations; i++) {
+        for (uint8_t screen = 0; screen < num_screens; screen++) {
+            dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_UI, &bench->queries[screen]);
+        }
+    }
+    report(bench,
+           vector,
+           "QUERY_CONTRACT_UI",
+           counters_since(start),
+           (uint64_t) bench->iterations * num_screens,
+           0);
+    return true;
+}
+
+static bool selected(const host_vector_t *vector, char **filters, int filters_count) {
+    if (filters_count == 0) {
+        return true;
+    }
+    for (int i = 0; i < filters_count; i++) {
+        if (strcmp(filters[i], vector->name) == 0 || strcmp(filters[i], vector->family) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-n iterations] [-c] [-f name|family]...\n", name);
+}
+
+int main(int argc, char **argv) {
+    static bench_t bench;
+    char *filters[64];
+    int filters_count = 0;
+    int opt;
+
+    bench.iterations = DEFAULT_ITERATIONS;
+    while ((opt = getopt(argc, argv, "n:cf:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                bench.iterations = (unsigned) strtoul(optarg, NULL, 10);
+                break;
+            case 'c':
+                bench.csv = true;
+                break;
+            case 'f':
+                if (filters_count < (int) (sizeof(filters) / sizeof(filters[0]))) {
+                    filters[filters_count++] = optarg;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (bench.iterations == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    perf_open();
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    if (bench.csv) {
+        printf("transaction,family,message,ns_per_call,instructions_per_call\n");
+    } else {
+        printf("%-32s %-10s %-20s %10s %12s\n",
+               "transaction",
+               "family",
+               "message",
+               "ns/call",
+               "instr/call");
+    }
+
+    int status = 0;
+    for (size_t i = 0; i < HOST_VECTORS_COUNT; i++) {
+        if (selected(&HOST_VECTORS[i], filters, filters_count) &&
+            !run_vector(&bench, &HOST_VECTORS[i])) {
+            status = 1;
+        }
+    }
+    return status;
+}
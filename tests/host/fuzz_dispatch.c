@@ -0,0 +1,257 @@
+// Fuzz target over the whole plugin message state machine. Every input is a script of
+// `dispatch_plugin_calls` messages, replayed in order, so that the fuzzer also explores sequences
+// app-ethereum never sends: parameters after FINALIZE, missing or repeated PROVIDE_INFO, screens
+// past numScreens, unknown selectors, re-initialisation...
+//
+//   make -C tests/host fuzz            # clang: libFuzzer + ASan/UBSan
+//   ./tests/host/build/fuzz/fuzz_dispatch -max_total_time=300
+//   make -C tests/host fuzz_smoke      # any compiler: random inputs through fuzz_main.c
+//
+// Input layout:
+//   byte 0   selector: index in YEARN_SELECTORS, or NUM_SELECTORS for the next 4 raw bytes
+//   byte 1   destination: vault then Iron Bank market of the first chain, destination of a
+//            HOST_VECTORS entry (zaps, router), or the next 20 raw bytes
+//   then     operations, one byte each (`op_t` is the value modulo OP_COUNT) and their operands
+//
+// Title and message buffers are allocated at their exact size so that ASan catches any write past
+// msgLength / titleLength; strings must always be NUL-terminated within them.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vectors.h"
+
+typedef enum {
+    OP_PARAMETER,     // word kind, then its operands, see `read_word`
+    OP_FINALIZE,      // sender: 0 default, 1 last address word, 2 zero address
+    OP_PROVIDE_INFO,  // bit 0: drop item1, bit 1: drop item2
+    OP_QUERY_ID,      // -
+    OP_QUERY_UI,      // screen index
+    OP_INIT,          // selector byte, as byte 0
+    OP_UNKNOWN,       // message number
+    OP_CHAIN_ID,      // length, then the big-endian chain ID used from now on
+    OP_COUNT,
+} op_t;
+
+typedef enum {
+    WORD_RAW,      // 32 bytes
+    WORD_VAULT,    // index in the first chain's vaults, as an address word
+    WORD_TOKEN,    // index in HOST_TOKENS, or the zero address, as an address word
+    WORD_UINT16,   // 2 bytes, as a uint256
+    WORD_SENDER,   // the default sender, as an address word
+    WORD_COUNT,
+} word_t;
+
+typedef struct input_t {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+} input_t;
+
+static bool read_bytes(input_t *input, uint8_t *out, size_t len) {
+    if (input->size - input->pos < len) {
+        return false;
+    }
+    memcpy(out, input->data + input->pos, len);
+    input->pos += len;
+    return true;
+}
+
+static uint8_t read_byte(input_t *input) {
+    uint8_t byte = 0;
+    read_bytes(input, &byte, 1);
+    return byte;
+}
+
+static void read_selector(input_t *input, uint8_t selector[SELECTOR_SIZE]) {
+    uint8_t index = read_byte(input) % (NUM_SELECTORS + 1);
+    if (index < NUM_SELECTORS) {
+        memcpy(selector, YEARN_SELECTORS[index], SELECTOR_SIZE);
+    } else if (!read_bytes(input, selector, SELECTOR_SIZE)) {
+        memset(selector, 0, SELECTOR_SIZE);
+    }
+}
+
+static void read_destination(input_t *input, uint8_t destination[ADDRESS_LENGTH]) {
+    const chain_t *chain = &CHAINS[0];
+    size_t tables_count = chain->yearn_vaults_count + chain->iron_bank_count;
+    size_t index = read_byte(input) % (tables_count + HOST_VECTORS_COUNT + 1);
+    if (index < chain->yearn_vaults_count) {
+        memcpy(destination, chain->yearn_vaults[index].address, ADDRESS_LENGTH);
+    } else if (index < tables_count) {
+        memcpy(destination,
+               chain->iron_bank[index - chain->yearn_vaults_count].address,
+               ADDRESS_LENGTH);
+    } else if (index < tables_count + HOST_VECTORS_COUNT) {
+        host_parse_hex(HOST_VECTORS[index - tables_count].destination, destination, ADDRESS_LENGTH);
+    } else if (!read_bytes(input, destination, ADDRESS_LENGTH)) {
+        memset(destination, 0, ADDRESS_LENGTH);
+    }
+}
+
+// Builds the next 32-byte parameter, mostly well-formed so that the fuzzer gets past the parsing.
+static void read_word(input_t *input, const host_tx_t *tx, uint8_t word[PARAMETER_LENGTH]) {
+    uint8_t *address = word + PARAMETER_LENGTH - ADDRESS_LENGTH;
+    uint8_t index;
+
+    memset(word, 0, PARAMETER_LENGTH);
+    switch (read_byte(input) % WORD_COUNT) {
+        case WORD_RAW:
+            read_bytes(input, word, PARAMETER_LENGTH);
+            break;
+        case WORD_VAULT:
+            memcpy(address,
+                   CHAINS[0].yearn_vaults[read_byte(input) % CHAINS[0].yearn_vaults_count].address,
+                   ADDRESS_LENGTH);
+            break;
+        case WORD_TOKEN:
+            index = read_byte(input) % (HOST_TOKENS_COUNT + 1);
+            if (index < HOST_TOKENS_COUNT) {
+                memcpy(address, HOST_TOKENS[index].address, ADDRESS_LENGTH);
+            }
+            break;
+        case WORD_UINT16:
+            read_bytes(input, word + PARAMETER_LENGTH - 2, 2);
+            break;
+        default:
+            memcpy(address, tx->sender, ADDRESS_LENGTH);
+            break;
+    }
+}
+
+static void check_string(const char *buffer, size_t size, const char *what) {
+    if (memchr(buffer, '\0', size) == NULL) {
+        fprintf(stderr, "%s is not NUL-terminated\n", what);
+        abort();
+    }
+}
+
+static void check_result(uint8_t result, const char *message) {
+    switch (result) {
+        case ETH_PLUGIN_RESULT_ERROR:
+        case ETH_PLUGIN_RESULT_UNAVAILABLE:
+        case ETH_PLUGIN_RESULT_OK:
+            return;
+        default:
+            fprintf(stderr, "%s: unexpected result %d\n", message, result);
+            abort();
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    static host_tx_t tx;
+    static uint8_t calldata[SELECTOR_SIZE + PARAMETER_LENGTH];
+    uint8_t destination[ADDRESS_LENGTH];
+    uint8_t last_address[ADDRESS_LENGTH] = {0};
+    input_t input = {data, size, 0};
+    ethPluginInitContract_t init;
+    ethPluginProvideParameter_t param;
+    ethPluginFinalize_t finalize;
+    ethPluginProvideInfo_t info;
+    ethQueryContractID_t query_id;
+    ethQueryContractUI_t query_ui;
+    bool finalized = false;
+
+    read_selector(&input, calldata);
+    read_destination(&input, destination);
+    host_tx_init(&tx, destination, HOST_TOKENS, HOST_TOKENS_COUNT);
+    memset(&finalize, 0, sizeof(finalize));
+
+    host_msg_init_contract(&tx, &init, calldata, sizeof(calldata));
+    dispatch_plugin_calls(ETH_PLUGIN_INIT_CONTRACT, &init);
+    check_result(init.result, "INIT_CONTRACT");
+
+    while (input.pos < input.size) {
+        switch (read_byte(&input) % OP_COUNT) {
+            case OP_PARAMETER:
+                read_word(&input, &tx, calldata + SELECTOR_SIZE);
+                memcpy(last_address,
+                       calldata + SELECTOR_SIZE + PARAMETER_LENGTH - ADDRESS_LENGTH,
+                       ADDRESS_LENGTH);
+                host_msg_provide_parameter(&tx, &param, calldata, SELECTOR_SIZE);
+                dispatch_plugin_calls(ETH_PLUGIN_PROVIDE_PARAMETER, &param);
+                check_result(param.result, "PROVIDE_PARAMETER");
+                break;
+            case OP_FINALIZE: {
+                uint8_t sender = read_byte(&input) % 3;
+                if (sender == 1) {
+                    memcpy(tx.sender, last_address, ADDRESS_LENGTH);
+                } else if (sender == 2) {
+                    memset(tx.sender, 0, ADDRESS_LENGTH);
+                }
+                host_msg_finalize(&tx, &finalize);
+                dispatch_plugin_calls(ETH_PLUGIN_FINALIZE, &finalize);
+                check_result(finalize.result, "FINALIZE");
+                finalized = true;
+                break;
+            }
+            case OP_PROVIDE_INFO: {
+                uint8_t drop = read_byte(&input);
+                host_msg_provide_info(&tx, &info, &finalize);
+                if (drop & 1) {
+                    info.item1 = NULL;
+                    tx.has_item1 = false;
+                }
+                if (drop & 2) {
+                    info.item2 = NULL;
+                    tx.has_item2 = false;
+                }
+                dispatch_plugin_calls(ETH_PLUGIN_PROVIDE_INFO, &info);
+                check_result(info.result, "PROVIDE_INFO");
+                break;
+            }
+            case OP_QUERY_ID: {
+                char *name = malloc(HOST_TITLE_LEN);
+                char *version = malloc(HOST_TITLE_LEN);
+                host_msg_query_id(&tx, &query_id, name, HOST_TITLE_LEN, version, HOST_TITLE_LEN);
+                dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_ID, &query_id);
+                check_result(query_id.result, "QUERY_CONTRACT_ID");
+                check_string(name, HOST_TITLE_LEN, "name");
+                check_string(version, HOST_TITLE_LEN, "version");
+                free(name);
+                free(version);
+                break;
+            }
+            case OP_QUERY_UI: {
+                uint8_t screen = read_byte(&input);
+                char *title = malloc(HOST_TITLE_LEN);
+                char *msg = malloc(HOST_MSG_LEN);
+                unsigned int amount_too_long = host_amount_too_long;
+                host_msg_query_ui(&tx, &query_ui, screen, title, HOST_TITLE_LEN, msg, HOST_MSG_LEN);
+                dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_UI, &query_ui);
+                check_result(query_ui.result, "QUERY_CONTRACT_UI");
+                check_string(title, HOST_TITLE_LEN, "title");
+                check_string(msg, HOST_MSG_LEN, "msg");
+                // Every screen announced by FINALIZE must render, except an amount too long for
+                // msg, which AMOUNT_TOO_LONG counts.
+                if (finalized && screen < finalize.numScreens &&
+                    query_ui.result != ETH_PLUGIN_RESULT_OK &&
+                    host_amount_too_long == amount_too_long &&
+                    finalize.result == ETH_PLUGIN_RESULT_OK &&
+                    init.result == ETH_PLUGIN_RESULT_OK) {
+                    fprintf(stderr, "screen %d of %d failed\n", screen, finalize.numScreens);
+                    abort();
+                }
+                free(title);
+                free(msg);
+                break;
+            }
+            case OP_INIT:
+                read_selector(&input, calldata);
+                host_msg_init_contract(&tx, &init, calldata, sizeof(calldata));
+                dispatch_plugin_calls(ETH_PLUGIN_INIT_CONTRACT, &init);
+                check_result(init.result, "INIT_CONTRACT");
+                finalized = false;
+                break;
+            case OP_CHAIN_ID:
+                tx.content.chainID.length = read_byte(&input) % (INT256_LENGTH + 1);
+                memset(tx.content.chainID.value, 0, INT256_LENGTH);
+                read_bytes(&input, tx.content.chainID.value, tx.content.chainID.length);
+                break;
+            case OP_UNKNOWN:
+                // Messages the plugin does not handle must be ignored, parameters untouched.
+                dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_UI + 1 + read_byte(&input), NULL);
+                break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Stand-alone driver for fuzz_dispatch.c, for compilers without libFuzzer: replays the given
+// inputs (crash reproducers, corpus files), or runs random ones.
+//
+//   ./tests/host/build/fuzz_smoke [-n runs] [-s seed] [file...]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define DEFAULT_RUNS   200000
+#define MAX_INPUT_SIZE 4096
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static uint64_t rng_state;
+
+// xorshift64*, so that a failure can be replayed from its seed.
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static int replay(const char *path) {
+    static uint8_t data[MAX_INPUT_SIZE];
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return 1;
+    }
+    size_t size = fread(data, 1, sizeof(data), file);
+    fclose(file);
+    LLVMFuzzerTestOneInput(data, size);
+    return 0;
+}
+
+// Random scripts, short ones first: most of the state machine is reached within a few messages.
+static void run_random(unsigned long runs) {
+    static uint8_t data[MAX_INPUT_SIZE];
+    for (unsigned long n = 0; n < runs; n++) {
+        size_t size = rng_next() % (n % 16 == 0 ? sizeof(data) : 64);
+        for (size_t i = 0; i < size; i++) {
+            data[i] = rng_next();
+        }
+        LLVMFuzzerTestOneInput(data, size);
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned long runs = DEFAULT_RUNS;
+    uint64_t seed = 0x5eed;
+    int files = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            runs = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 0);
+        } else {
+            files++;
+            if (replay(argv[i]) != 0) {
+                return 1;
+            }
+        }
+    }
+    if (files == 0) {
+        rng_state = seed != 0 ? seed : 1;
+        run_random(runs);
+    }
+    printf("ok\n");
+    return 0;
+}
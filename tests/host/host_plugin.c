@@ -0,0 +1,230 @@
+#include <stdio.h>
+
+#include "host_plugin.h"
+
+// 0xFE984369CE3919AA7BB4F431082D027B4F8ED70C, SPECULOS_ADDRESS in tests/src/test.fixture.js.
+static const uint8_t SPECULOS_ADDRESS[ADDRESS_LENGTH] = {0xfe, 0x98, 0x43, 0x69, 0xce, 0x39, 0x19,
+                                                         0xaa, 0x7b, 0xb4, 0xf4, 0x31, 0x08, 0x2d,
+                                                         0x02, 0x7b, 0x4f, 0x8e, 0xd7, 0x0c};
+
+// NVM registry, defined in main.c on the device. N_ variables are const, in flash, and only
+// written by nvm_write: on the host they are put in a writable section.
+const nvm_registry_t N_registry_real __attribute__((section(".data.N_registry_real")));
+
+void host_tx_init(host_tx_t *tx,
+                  const uint8_t destination[ADDRESS_LENGTH],
+                  const tokenDefinition_t *tokens,
+                  size_t tokens_count) {
+    memset(tx, 0, sizeof(*tx));
+    memcpy(tx->sender, SPECULOS_ADDRESS, ADDRESS_LENGTH);
+    memcpy(tx->content.destination, destination, ADDRESS_LENGTH);
+    tx->content.destinationLength = ADDRESS_LENGTH;
+    tx->content.chainID.value[0] = 1;
+    tx->content.chainID.length = 1;
+    tx->content.dataPresent = true;
+    tx->shared_rw.sha3 = &tx->sha3;
+    tx->shared_ro.txContent = &tx->content;
+    tx->tokens = tokens;
+    tx->tokens_count = tokens_count;
+}
+
+static bool lookup_token(host_tx_t *tx, const uint8_t *address, extraInfo_t *item) {
+    if (address == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < tx->tokens_count; i++) {
+        if (memcmp(tx->tokens[i].address, address, ADDRESS_LENGTH) == 0) {
+            item->token = tx->tokens[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+void host_msg_init_contract(host_tx_t *tx,
+                            ethPluginInitContract_t *msg,
+                            const uint8_t *calldata,
+                            size_t calldata_len) {
+    memset(msg, 0, sizeof(*msg));
+    msg->interfaceVersion = ETH_PLUGIN_INTERFACE_VERSION_LATEST;
+    msg->pluginSharedRW = &tx->shared_rw;
+    msg->pluginSharedRO = &tx->shared_ro;
+    msg->pluginContext = tx->context;
+    msg->pluginContextLength = sizeof(tx->context);
+    msg->selector = calldata;
+    msg->dataSize = calldata_len;
+}
+
+void host_msg_provide_parameter(host_tx_t *tx,
+                                ethPluginProvideParameter_t *msg,
+                                const uint8_t *calldata,
+                                size_t offset) {
+    memset(msg, 0, sizeof(*msg));
+    msg->pluginSharedRW = &tx->shared_rw;
+    msg->pluginSharedRO = &tx->shared_ro;
+    msg->pluginContext = tx->context;
+    msg->parameter = calldata + offset;
+    msg->parameterOffset = offset;
+}
+
+void host_msg_finalize(host_tx_t *tx, ethPluginFinalize_t *msg) {
+    memset(msg, 0, sizeof(*msg));
+    msg->pluginSharedRW = &tx->shared_rw;
+    msg->pluginSharedRO = &tx->shared_ro;
+    msg->pluginContext = tx->context;
+    msg->address = tx->sender;
+}
+
+void host_msg_provide_info(host_tx_t *tx,
+                           ethPluginProvideInfo_t *msg,
+                           const ethPluginFinalize_t *finalize) {
+    tx->has_item1 = lookup_token(tx, finalize->tokenLookup1, &tx->item1);
+    tx->has_item2 = lookup_token(tx, finalize->tokenLookup2, &tx->item2);
+
+    memset(msg, 0, sizeof(*msg));
+    msg->pluginSharedRW = &tx->shared_rw;
+    msg->pluginSharedRO = &tx->shared_ro;
+    msg->pluginContext = tx->context;
+    msg->item1 = tx->has_item1 ? &tx->item1 : NULL;
+    msg->item2 = tx->has_item2 ? &tx->item2 : NULL;
+}
+
+void host_msg_query_id(host_tx_t *tx,
+                       ethQueryContractID_t *msg,
+                       char *name,
+                       size_t name_len,
+                       char *version,
+                       size_t version_len) {
+    memset(msg, 0, sizeof(*msg));
+    msg->pluginSharedRW = &tx->shared_rw;
+    msg->pluginSharedRO = &tx->shared_ro;
+    msg->pluginContext = tx->context;
+    msg->name = name;
+    msg->nameLength = name_len;
+    msg->version = version;
+    msg->versionLength = version_len;
+    name[0] = '\0';
+    version[0] = '\0';
+}
+
+void host_msg_query_ui(host_tx_t *tx,
+                       ethQueryContractUI_t *msg,
+                       uint8_t screen,
+                       char *title,
+                       size_t title_len,
+                       char *msg_buffer,
+                       size_t msg_len) {
+    memset(msg, 0, sizeof(*msg));
+    msg->pluginSharedRW = &tx->shared_rw;
+    msg->pluginSharedRO = &tx->shared_ro;
+    msg->item1 = tx->has_item1 ? &tx->item1 : NULL;
+    msg->item2 = tx->has_item2 ? &tx->item2 : NULL;
+    strlcpy(msg->network_ticker, "ETH", sizeof(msg->network_ticker));
+    msg->pluginContext = tx->context;
+    msg->screenIndex = screen;
+    msg->title = title;
+    msg->titleLength = title_len;
+    msg->msg = msg_buffer;
+    msg->msgLength = msg_len;
+    memset(title, 0, title_len);
+    memset(msg_buffer, 0, msg_len);
+}
+
+uint8_t host_tx_run(host_tx_t *tx, const uint8_t *calldata, size_t calldata_len) {
+    if (calldata_len < SELECTOR_SIZE) {
+        return ETH_PLUGIN_RESULT_UNAVAILABLE;
+    }
+
+    ethPluginInitContract_t init;
+    host_msg_init_contract(tx, &init, calldata, calldata_len);
+    dispatch_plugin_calls(ETH_PLUGIN_INIT_CONTRACT, &init);
+    if (init.result != ETH_PLUGIN_RESULT_OK) {
+        return init.result;
+    }
+
+    // app-ethereum only forwards complete words, a trailing partial word is ignored.
+    for (size_t offset = SELECTOR_SIZE; offset + PARAMETER_LENGTH <= calldata_len;
+         offset += PARAMETER_LENGTH) {
+        ethPluginProvideParameter_t param;
+        host_msg_provide_parameter(tx, &param, calldata, offset);
+        dispatch_plugin_calls(ETH_PLUGIN_PROVIDE_PARAMETER, &param);
+        if (param.result != ETH_PLUGIN_RESULT_OK) {
+            return param.result;
+        }
+    }
+
+    ethPluginFinalize_t finalize;
+    host_msg_finalize(tx, &finalize);
+    dispatch_plugin_calls(ETH_PLUGIN_FINALIZE, &finalize);
+    if (finalize.result != ETH_PLUGIN_RESULT_OK) {
+        return finalize.result;
+    }
+    tx->ui_type = finalize.uiType;
+    tx->num_screens = finalize.numScreens;
+
+    if (finalize.tokenLookup1 != NULL || finalize.tokenLookup2 != NULL) {
+        ethPluginProvideInfo_t info;
+        host_msg_provide_info(tx, &info, &finalize);
+        dispatch_plugin_calls(ETH_PLUGIN_PROVIDE_INFO, &info);
+        if (info.result != ETH_PLUGIN_RESULT_OK) {
+            return info.result;
+        }
+        tx->num_screens += info.additionalScreens;
+    }
+    return ETH_PLUGIN_RESULT_OK;
+}
+
+uint8_t host_tx_query_id(host_tx_t *tx,
+                         char *name,
+                         size_t name_len,
+                         char *version,
+                         size_t version_len) {
+    ethQueryContractID_t query;
+    host_msg_query_id(tx, &query, name, name_len, version, version_len);
+    dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_ID, &query);
+    return query.result;
+}
+
+uint8_t host_tx_query_ui(host_tx_t *tx,
+                         uint8_t screen,
+                         char *title,
+                         size_t title_len,
+                         char *msg,
+                         size_t msg_len) {
+    ethQueryContractUI_t query;
+    host_msg_query_ui(tx, &query, screen, title, title_len, msg, msg_len);
+    dispatch_plugin_calls(ETH_PLUGIN_QUERY_CONTRACT_UI, &query);
+    return query.result;
+}
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+int host_parse_hex(const char *hex, uint8_t *out, size_t out_size) {
+    if (hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+        hex += 2;
+    }
+    size_t len = strlen(hex);
+    if (len % 2 != 0 || len / 2 > out_size) {
+        return -1;
+    }
+    for (size_t i = 0; i < len / 2; i++) {
+        int high = hex_value(hex[2 * i]);
+        int low = hex_value(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return -1;
+        }
+        out[i] = (uint8_t) (high << 4 | low);
+    }
+    return (int) (len / 2);
+}
@@ -0,0 +1,84 @@
+// Drives `dispatch_plugin_calls` on the host the way app-ethereum does on the device: init with
+// the selector, one PROVIDE_PARAMETER per 32-byte word, FINALIZE, PROVIDE_INFO when a token
+// lookup was requested, then QUERY_CONTRACT_ID and QUERY_CONTRACT_UI on demand.
+#pragma once
+
+#include "yearn_plugin.h"
+
+#define HOST_MAX_CALLDATA 4096
+#define HOST_TITLE_LEN    32
+#define HOST_MSG_LEN      64
+
+typedef struct host_tx_t {
+    // Plugin context, as provided by app-ethereum.
+    uint8_t context[PLUGIN_CONTEXT_SIZE] __attribute__((aligned(8)));
+    cx_sha3_t sha3;
+    txContent_t content;
+    // Address of the signer, passed in FINALIZE. Defaults to the Speculos seed's first address.
+    uint8_t sender[ADDRESS_LENGTH];
+    ethPluginSharedRW_t shared_rw;
+    ethPluginSharedRO_t shared_ro;
+    // Tokens known to the Ethereum app, returned for tokenLookup1 / tokenLookup2.
+    const tokenDefinition_t *tokens;
+    size_t tokens_count;
+    extraInfo_t item1;
+    extraInfo_t item2;
+    bool has_item1;
+    bool has_item2;
+    // Set by FINALIZE / PROVIDE_INFO.
+    uint8_t ui_type;
+    uint8_t num_screens;
+} host_tx_t;
+
+// Resets `tx` for a new transaction to `destination`, looking tokens up in `tokens`.
+void host_tx_init(host_tx_t *tx,
+                  const uint8_t destination[ADDRESS_LENGTH],
+                  const tokenDefinition_t *tokens,
+                  size_t tokens_count);
+
+// Feeds `calldata` (selector followed by 32-byte words) to the plugin, up to PROVIDE_INFO.
+// Returns ETH_PLUGIN_RESULT_OK, or the result of the first message that did not succeed.
+uint8_t host_tx_run(host_tx_t *tx, const uint8_t *calldata, size_t calldata_len);
+
+// The steps of `host_tx_run`, for callers that need to look at or time each message.
+void host_msg_init_contract(host_tx_t *tx,
+                            ethPluginInitContract_t *msg,
+                            const uint8_t *calldata,
+                            size_t calldata_len);
+void host_msg_provide_parameter(host_tx_t *tx,
+                                ethPluginProvideParameter_t *msg,
+                                const uint8_t *calldata,
+                                size_t offset);
+void host_msg_finalize(host_tx_t *tx, ethPluginFinalize_t *msg);
+// Resolves the token lookups requested by `finalize` into `tx->item1` / `tx->item2`.
+void host_msg_provide_info(host_tx_t *tx,
+                           ethPluginProvideInfo_t *msg,
+                           const ethPluginFinalize_t *finalize);
+void host_msg_query_id(host_tx_t *tx,
+                       ethQueryContractID_t *msg,
+                       char *name,
+                       size_t name_len,
+                       char *version,
+                       size_t version_len);
+void host_msg_query_ui(host_tx_t *tx,
+                       ethQueryContractUI_t *msg,
+                       uint8_t screen,
+                       char *title,
+                       size_t title_len,
+                       char *msg_buffer,
+                       size_t msg_len);
+
+uint8_t host_tx_query_id(host_tx_t *tx,
+                         char *name,
+                         size_t name_len,
+                         char *version,
+                         size_t version_len);
+uint8_t host_tx_query_ui(host_tx_t *tx,
+                         uint8_t screen,
+                         char *title,
+                         size_t title_len,
+                         char *msg,
+                         size_t msg_len);
+
+// Parses a hex string, with or without "0x", into `out`. Returns the number of bytes, or -1.
+int host_parse_hex(const char *hex, uint8_t *out, size_t out_size);
@@ -0,0 +1,361 @@
+// Host implementations of the BOLOS SHA-256 and secp256k1 ECDSA verification, for the NVM
+// registry. Plain and slow (bitwise modular multiplication), but a verification takes a few
+// milliseconds: enough for tests.
+#include <string.h>
+
+#include "cx.h"
+
+static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static uint32_t rotr32(uint32_t x, uint8_t n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+static void sha256_block(uint32_t state[8], const uint8_t block[64]) {
+    uint32_t w[64], s[8];
+
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t) block[4 * i] << 24 | (uint32_t) block[4 * i + 1] << 16 |
+               (uint32_t) block[4 * i + 2] << 8 | block[4 * i + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    memcpy(s, state, sizeof(s));
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = s[7] + (rotr32(s[4], 6) ^ rotr32(s[4], 11) ^ rotr32(s[4], 25)) +
+                      ((s[4] & s[5]) ^ (~s[4] & s[6])) + SHA256_K[i] + w[i];
+        uint32_t t2 = (rotr32(s[0], 2) ^ rotr32(s[0], 13) ^ rotr32(s[0], 22)) +
+                      ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+        memmove(s + 1, s, 7 * sizeof(s[0]));
+        s[4] += t1;
+        s[0] = t1 + t2;
+    }
+    for (int i = 0; i < 8; i++) {
+        state[i] += s[i];
+    }
+}
+
+int cx_sha256_init(cx_sha256_t *hash) {
+    static const uint32_t IV[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                   0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    memset(hash, 0, sizeof(*hash));
+    hash->header.algo = CX_SHA256;
+    memcpy(hash->state, IV, sizeof(IV));
+    return CX_SHA256;
+}
+
+int cx_hash(cx_hash_t *header,
+            int mode,
+            const uint8_t *in,
+            size_t len,
+            uint8_t *out,
+            size_t out_len) {
+    cx_sha256_t *hash = (cx_sha256_t *) header;
+
+    hash->length += len;
+    for (size_t i = 0; i < len; i++) {
+        hash->block[hash->block_len++] = in[i];
+        if (hash->block_len == sizeof(hash->block)) {
+            sha256_block(hash->state, hash->block);
+            hash->block_len = 0;
+        }
+    }
+    if (!(mode & CX_LAST)) {
+        return 0;
+    }
+    uint64_t bits = hash->length * 8;
+    hash->block[hash->block_len++] = 0x80;
+    if (hash->block_len > 56) {
+        memset(hash->block + hash->block_len, 0, sizeof(hash->block) - hash->block_len);
+        sha256_block(hash->state, hash->block);
+        hash->block_len = 0;
+    }
+    memset(hash->block + hash->block_len, 0, 56 - hash->block_len);
+    for (int i = 0; i < 8; i++) {
+        hash->block[56 + i] = bits >> (56 - 8 * i);
+    }
+    sha256_block(hash->state, hash->block);
+    for (size_t i = 0; i < CX_SHA256_SIZE && i < out_len; i++) {
+        out[i] = hash->state[i / 4] >> (24 - 8 * (i % 4));
+    }
+    return CX_SHA256_SIZE;
+}
+
+// 256-bit integers, least significant limb first.
+typedef struct bn_t {
+    uint32_t limb[8];
+} bn_t;
+
+typedef struct point_t {
+    bn_t x, y, z;  // Jacobian coordinates, z = 0 for the point at infinity.
+} point_t;
+
+static const bn_t P = {{0xFFFFFC2F, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+                        0xFFFFFFFF, 0xFFFFFFFF}};
+static const bn_t N = {{0xD0364141, 0xBFD25E8C, 0xAF48A03B, 0xBAAEDCE6, 0xFFFFFFFE, 0xFFFFFFFF,
+                        0xFFFFFFFF, 0xFFFFFFFF}};
+static const point_t G = {
+    {{0x16F81798, 0x59F2815B, 0x2DCE28D9, 0x029BFCDB, 0xCE870B07, 0x55A06295, 0xF9DCBBAC,
+      0x79BE667E}},
+    {{0xFB10D4B8, 0x9C47D08F, 0xA6855419, 0xFD17B448, 0x0E1108A8, 0x5DA4FBFC, 0x26A3C465,
+      0x483ADA77}},
+    {{1}}};
+
+static void bn_read(bn_t *r, const uint8_t *in, size_t len) {
+    memset(r, 0, sizeof(*r));
+    for (size_t i = 0; i < len; i++) {
+        size_t bit = 8 * (len - 1 - i);
+        r->limb[bit / 32] |= (uint32_t) in[i] << (bit % 32);
+    }
+}
+
+static int bn_cmp(const bn_t *a, const bn_t *b) {
+    for (int i = 7; i >= 0; i--) {
+        if (a->limb[i] != b->limb[i]) {
+            return a->limb[i] < b->limb[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static int bn_is_zero(const bn_t *a) {
+    static const bn_t ZERO;
+    return bn_cmp(a, &ZERO) == 0;
+}
+
+static uint32_t bn_add(bn_t *r, const bn_t *a, const bn_t *b) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; i++) {
+        carry += (uint64_t) a->limb[i] + b->limb[i];
+        r->limb[i] = (uint32_t) carry;
+        carry >>= 32;
+    }
+    return (uint32_t) carry;
+}
+
+static uint32_t bn_sub(bn_t *r, const bn_t *a, const bn_t *b) {
+    int64_t borrow = 0;
+    for (int i = 0; i < 8; i++) {
+        borrow += (int64_t) a->limb[i] - b->limb[i];
+        r->limb[i] = (uint32_t) borrow;
+        borrow >>= 32;
+    }
+    return borrow != 0;
+}
+
+// Modular operations, for operands lower than `m`.
+static void mod_add(bn_t *r, const bn_t *a, const bn_t *b, const bn_t *m) {
+    if (bn_add(r, a, b) || bn_cmp(r, m) >= 0) {
+        bn_sub(r, r, m);
+    }
+}
+
+static void mod_sub(bn_t *r, const bn_t *a, const bn_t *b, const bn_t *m) {
+    if (bn_sub(r, a, b)) {
+        bn_add(r, r, m);
+    }
+}
+
+static void mod_mul(bn_t *r, const bn_t *a, const bn_t *b, const bn_t *m) {
+    bn_t result = {{0}};
+    for (int bit = 255; bit >= 0; bit--) {
+        mod_add(&result, &result, &result, m);
+        if (b->limb[bit / 32] >> (bit % 32) & 1) {
+            mod_add(&result, &result, a, m);
+        }
+    }
+    *r = result;
+}
+
+// a^(m - 2): the inverse of `a`, m being prime.
+static void mod_inv(bn_t *r, const bn_t *a, const bn_t *m) {
+    static const bn_t TWO = {{2}};
+    bn_t e, result = {{1}};
+    bn_sub(&e, m, &TWO);
+    for (int bit = 255; bit >= 0; bit--) {
+        mod_mul(&result, &result, &result, m);
+        if (e.limb[bit / 32] >> (bit % 32) & 1) {
+            mod_mul(&result, &result, a, m);
+        }
+    }
+    *r = result;
+}
+
+static void point_double(point_t *r, const point_t *a) {
+    bn_t y2, s, m, t;
+
+    if (bn_is_zero(&a->z) || bn_is_zero(&a->y)) {
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    mod_mul(&y2, &a->y, &a->y, &P);
+    mod_mul(&s, &a->x, &y2, &P);
+    mod_add(&s, &s, &s, &P);
+    mod_add(&s, &s, &s, &P);  // S = 4 X Y^2
+    mod_mul(&m, &a->x, &a->x, &P);
+    mod_add(&t, &m, &m, &P);
+    mod_add(&m, &t, &m, &P);  // M = 3 X^2
+    mod_mul(&r->z, &a->y, &a->z, &P);
+    mod_add(&r->z, &r->z, &r->z, &P);  // Z' = 2 Y Z
+    mod_mul(&r->x, &m, &m, &P);
+    mod_sub(&r->x, &r->x, &s, &P);
+    mod_sub(&r->x, &r->x, &s, &P);  // X' = M^2 - 2 S
+    mod_sub(&t, &s, &r->x, &P);
+    mod_mul(&t, &m, &t, &P);
+    mod_mul(&y2, &y2, &y2, &P);
+    mod_add(&y2, &y2, &y2, &P);
+    mod_add(&y2, &y2, &y2, &P);
+    mod_add(&y2, &y2, &y2, &P);
+    mod_sub(&r->y, &t, &y2, &P);  // Y' = M (S - X') - 8 Y^4
+}
+
+static void point_add(point_t *r, const point_t *a, const point_t *b) {
+    bn_t z1z1, z2z2, u1, u2, s1, s2, h, rr, h2, h3, t;
+
+    if (bn_is_zero(&a->z)) {
+        *r = *b;
+        return;
+    }
+    if (bn_is_zero(&b->z)) {
+        *r = *a;
+        return;
+    }
+    mod_mul(&z1z1, &a->z, &a->z, &P);
+    mod_mul(&z2z2, &b->z, &b->z, &P);
+    mod_mul(&u1, &a->x, &z2z2, &P);
+    mod_mul(&u2, &b->x, &z1z1, &P);
+    mod_mul(&s1, &a->y, &z2z2, &P);
+    mod_mul(&s1, &s1, &b->z, &P);
+    mod_mul(&s2, &b->y, &z1z1, &P);
+    mod_mul(&s2, &s2, &a->z, &P);
+    if (bn_cmp(&u1, &u2) == 0) {
+        if (bn_cmp(&s1, &s2) == 0) {
+            point_double(r, a);
+        } else {
+            memset(r, 0, sizeof(*r));
+        }
+        return;
+    }
+    mod_sub(&h, &u2, &u1, &P);
+    mod_sub(&rr, &s2, &s1, &P);
+    mod_mul(&h2, &h, &h, &P);
+    mod_mul(&h3, &h2, &h, &P);
+    mod_mul(&u1, &u1, &h2, &P);  // U1 H^2
+    mod_mul(&t, &a->z, &b->z, &P);
+    mod_mul(&r->z, &t, &h, &P);  // Z3 = Z1 Z2 H
+    mod_mul(&r->x, &rr, &rr, &P);
+    mod_sub(&r->x, &r->x, &h3, &P);
+    mod_sub(&r->x, &r->x, &u1, &P);
+    mod_sub(&r->x, &r->x, &u1, &P);  // X3 = R^2 - H^3 - 2 U1 H^2
+    mod_sub(&t, &u1, &r->x, &P);
+    mod_mul(&t, &rr, &t, &P);
+    mod_mul(&s1, &s1, &h3, &P);
+    mod_sub(&r->y, &t, &s1, &P);  // Y3 = R (U1 H^2 - X3) - S1 H^3
+}
+
+static void point_mul(point_t *r, const bn_t *k, const point_t *a) {
+    point_t result;
+
+    memset(&result, 0, sizeof(result));
+    for (int bit = 255; bit >= 0; bit--) {
+        point_double(&result, &result);
+        if (k->limb[bit / 32] >> (bit % 32) & 1) {
+            point_add(&result, &result, a);
+        }
+    }
+    *r = result;
+}
+
+int cx_ecfp_init_public_key(cx_curve_t curve,
+                            const uint8_t *raw_key,
+                            size_t key_len,
+                            cx_ecfp_public_key_t *key) {
+    memset(key, 0, sizeof(*key));
+    key->curve = curve;
+    if (key_len == sizeof(key->W)) {
+        key->W_len = key_len;
+        memcpy(key->W, raw_key, key_len);
+    }
+    return (int) key->W_len;
+}
+
+// Reads a DER INTEGER lower than N into `r`. Returns the length read, 0 if invalid.
+static size_t der_read_integer(const uint8_t *in, size_t len, bn_t *r) {
+    if (len < 3 || in[0] != 0x02 || in[1] == 0 || in[1] > len - 2) {
+        return 0;
+    }
+    size_t size = in[1];
+    const uint8_t *value = in + 2;
+    if (size > 1 && value[0] == 0) {
+        value++;
+        size--;
+    }
+    if (size > 32) {
+        return 0;
+    }
+    bn_read(r, value, size);
+    if (bn_is_zero(r) || bn_cmp(r, &N) >= 0) {
+        return 0;
+    }
+    return 2 + in[1];
+}
+
+int cx_ecdsa_verify(const cx_ecfp_public_key_t *key,
+                    int mode,
+                    int hash_id,
+                    const uint8_t *hash,
+                    size_t hash_len,
+                    const uint8_t *sig,
+                    size_t sig_len) {
+    bn_t r, s, e, w, u1, u2;
+    point_t q, p1, p2;
+    size_t len;
+
+    (void) mode;
+    (void) hash_id;
+    if (key->curve != CX_CURVE_256K1 || key->W_len != 65 || key->W[0] != 0x04 ||
+        hash_len != 32 || sig_len < 8 || sig[0] != 0x30 || sig[1] != sig_len - 2) {
+        return 0;
+    }
+    if ((len = der_read_integer(sig + 2, sig_len - 2, &r)) == 0 ||
+        der_read_integer(sig + 2 + len, sig_len - 2 - len, &s) != sig_len - 2 - len) {
+        return 0;
+    }
+    bn_read(&q.x, key->W + 1, 32);
+    bn_read(&q.y, key->W + 33, 32);
+    memset(&q.z, 0, sizeof(q.z));
+    q.z.limb[0] = 1;
+
+    bn_read(&e, hash, 32);
+    if (bn_cmp(&e, &N) >= 0) {
+        bn_sub(&e, &e, &N);
+    }
+    mod_inv(&w, &s, &N);
+    mod_mul(&u1, &e, &w, &N);
+    mod_mul(&u2, &r, &w, &N);
+    point_mul(&p1, &u1, &G);
+    point_mul(&p2, &u2, &q);
+    point_add(&p1, &p1, &p2);
+    if (bn_is_zero(&p1.z)) {
+        return 0;
+    }
+    // x = X / Z^2, compared with r modulo N.
+    mod_mul(&w, &p1.z, &p1.z, &P);
+    mod_inv(&w, &w, &P);
+    mod_mul(&w, &p1.x, &w, &P);
+    if (bn_cmp(&w, &N) >= 0) {
+        bn_sub(&w, &w, &N);
+    }
+    return bn_cmp(&w, &r) == 0;
+}
@@ -0,0 +1,55 @@
+// Host stand-in for the BOLOS cx.h: the Keccak context used by getEthAddressStringFromBinary, and
+// the SHA-256 and ECDSA (secp256k1) verification used by the NVM registry, see cx.c.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct cx_sha3_s {
+    uint64_t state[25];
+} cx_sha3_t;
+
+void cx_keccak_256(cx_sha3_t *sha3, const uint8_t *in, size_t len, uint8_t *out);
+
+#define CX_LAST        1
+#define CX_SHA256      3
+#define CX_SHA256_SIZE 32
+
+typedef enum { CX_CURVE_256K1 = 0x21 } cx_curve_t;
+
+typedef struct cx_hash_s {
+    int algo;
+} cx_hash_t;
+
+typedef struct cx_sha256_s {
+    cx_hash_t header;
+    uint32_t state[8];
+    uint8_t block[64];
+    size_t block_len;
+    uint64_t length;
+} cx_sha256_t;
+
+typedef struct cx_ecfp_public_key_s {
+    cx_curve_t curve;
+    size_t W_len;
+    uint8_t W[65];
+} cx_ecfp_public_key_t;
+
+int cx_sha256_init(cx_sha256_t *hash);
+int cx_hash(cx_hash_t *hash,
+            int mode,
+            const uint8_t *in,
+            size_t len,
+            uint8_t *out,
+            size_t out_len);
+int cx_ecfp_init_public_key(cx_curve_t curve,
+                            const uint8_t *raw_key,
+                            size_t key_len,
+                            cx_ecfp_public_key_t *key);
+int cx_ecdsa_verify(const cx_ecfp_public_key_t *key,
+                    int mode,
+                    int hash_id,
+                    const uint8_t *hash,
+                    size_t hash_len,
+                    const uint8_t *sig,
+                    size_t sig_len);
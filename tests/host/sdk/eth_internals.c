@@ -0,0 +1,282 @@
+// Host implementations of the SDK helpers used by the plugin. The formatting helpers follow
+// app-ethereum so that the host build displays exactly what the device displays.
+#include "eth_internals.h"
+
+static const char HEXDIGITS[] = "0123456789abcdef";
+
+size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t len = strlen(src);
+    if (size != 0) {
+        size_t copy = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, copy);
+        dst[copy] = '\0';
+    }
+    return len;
+}
+
+static const uint64_t KECCAK_ROUND_CONSTANTS[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+    0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+
+static const uint8_t KECCAK_ROTATIONS[25] = {0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                             25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14};
+
+static uint64_t rotl64(uint64_t x, uint8_t n) {
+    return n == 0 ? x : (x << n) | (x >> (64 - n));
+}
+
+static void keccak_f1600(uint64_t a[25]) {
+    for (int round = 0; round < 24; round++) {
+        uint64_t c[5], b[25];
+        for (int x = 0; x < 5; x++) {
+            c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+        }
+        for (int x = 0; x < 5; x++) {
+            uint64_t d = c[(x + 4) % 5] ^ rotl64(c[(x + 1) % 5], 1);
+            for (int y = 0; y < 25; y += 5) {
+                a[y + x] ^= d;
+            }
+        }
+        for (int x = 0; x < 5; x++) {
+            for (int y = 0; y < 5; y++) {
+                b[y + 5 * ((2 * x + 3 * y) % 5)] =
+                    rotl64(a[x + 5 * y], KECCAK_ROTATIONS[x + 5 * y]);
+            }
+        }
+        for (int i = 0; i < 25; i += 5) {
+            for (int x = 0; x < 5; x++) {
+                a[i + x] = b[i + x] ^ (~b[i + (x + 1) % 5] & b[i + (x + 2) % 5]);
+            }
+        }
+        a[0] ^= KECCAK_ROUND_CONSTANTS[round];
+    }
+}
+
+// Keccak-256 as used by Ethereum (original padding, not SHA3-256).
+void cx_keccak_256(cx_sha3_t *sha3, const uint8_t *in, size_t len, uint8_t *out) {
+    const size_t rate = 136;
+    uint8_t block[136];
+
+    memset(sha3->state, 0, sizeof(sha3->state));
+    for (;;) {
+        size_t chunk = len < rate ? len : rate;
+        memset(block, 0, sizeof(block));
+        memcpy(block, in, chunk);
+        if (chunk < rate) {
+            block[chunk] ^= 0x01;
+            block[rate - 1] ^= 0x80;
+        }
+        for (size_t i = 0; i < rate / 8; i++) {
+            uint64_t lane = 0;
+            for (int j = 7; j >= 0; j--) {
+                lane = (lane << 8) | block[8 * i + j];
+            }
+            sha3->state[i] ^= lane;
+        }
+        keccak_f1600(sha3->state);
+        if (chunk < rate) {
+            break;
+        }
+        in += chunk;
+        len -= chunk;
+    }
+    for (int i = 0; i < 32; i++) {
+        out[i] = (uint8_t) (sha3->state[i / 8] >> (8 * (i % 8)));
+    }
+}
+
+void copy_address(uint8_t *dst, const uint8_t *parameter, uint8_t dst_size) {
+    uint8_t copy_size = MIN(dst_size, ADDRESS_LENGTH);
+    memmove(dst, parameter + PARAMETER_LENGTH - copy_size, copy_size);
+}
+
+void copy_parameter(uint8_t *dst, const uint8_t *parameter, uint8_t dst_size) {
+    uint8_t copy_size = MIN(dst_size, PARAMETER_LENGTH);
+    memmove(dst, parameter, copy_size);
+}
+
+static bool allzeroes(const void *buf, size_t n) {
+    const uint8_t *p = (const uint8_t *) buf;
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool uint256_to_decimal(const uint8_t *value, size_t value_len, char *out, size_t out_len) {
+    if (value_len > INT256_LENGTH) {
+        return false;
+    }
+
+    uint16_t n[16] = {0};
+    uint8_t bytes[INT256_LENGTH] = {0};
+    memcpy(bytes + INT256_LENGTH - value_len, value, value_len);
+    if (allzeroes(bytes, INT256_LENGTH)) {
+        if (out_len < 2) {
+            return false;
+        }
+        strlcpy(out, "0", out_len);
+        return true;
+    }
+    for (int i = 0; i < 16; i++) {
+        n[i] = (uint16_t) (bytes[2 * i] << 8 | bytes[2 * i + 1]);
+    }
+
+    size_t pos = out_len;
+    while (!allzeroes(n, sizeof(n))) {
+        if (pos == 0) {
+            return false;
+        }
+        pos -= 1;
+        uint32_t carry = 0;
+        for (int i = 0; i < 16; i++) {
+            uint32_t cur = (carry << 16) | n[i];
+            n[i] = (uint16_t) (cur / 10);
+            carry = cur % 10;
+        }
+        out[pos] = (char) ('0' + carry);
+    }
+    memmove(out, out + pos, out_len - pos);
+    out[out_len - pos] = '\0';
+    return true;
+}
+
+bool adjustDecimals(const char *src,
+                    size_t srcLength,
+                    char *target,
+                    size_t targetLength,
+                    uint8_t decimals) {
+    uint32_t startOffset;
+    uint32_t lastZeroOffset = 0;
+    uint32_t offset = 0;
+
+    if ((srcLength == 1) && (*src == '0')) {
+        if (targetLength < 2) {
+            return false;
+        }
+        target[0] = '0';
+        target[1] = '\0';
+        return true;
+    }
+    if (srcLength <= decimals) {
+        uint32_t delta = decimals - srcLength;
+        if (targetLength < srcLength + 1 + 2 + delta) {
+            return false;
+        }
+        target[offset++] = '0';
+        target[offset++] = '.';
+        for (uint32_t i = 0; i < delta; i++) {
+            target[offset++] = '0';
+        }
+        startOffset = offset;
+        for (uint32_t i = 0; i < srcLength; i++) {
+            target[offset++] = src[i];
+        }
+        target[offset] = '\0';
+    } else {
+        uint32_t sourceOffset = 0;
+        uint32_t delta = srcLength - decimals;
+        if (targetLength < srcLength + 1 + 1) {
+            return false;
+        }
+        while (offset < delta) {
+            target[offset++] = src[sourceOffset++];
+        }
+        if (decimals != 0) {
+            target[offset++] = '.';
+        }
+        startOffset = offset;
+        while (sourceOffset < srcLength) {
+            target[offset++] = src[sourceOffset++];
+        }
+        target[offset] = '\0';
+    }
+    for (uint32_t i = startOffset; i < offset; i++) {
+        if (target[i] == '0') {
+            if (lastZeroOffset == 0) {
+                lastZeroOffset = i;
+            }
+        } else {
+            lastZeroOffset = 0;
+        }
+    }
+    if (lastZeroOffset != 0) {
+        target[lastZeroOffset] = '\0';
+        if (target[lastZeroOffset - 1] == '.') {
+            target[lastZeroOffset - 1] = '\0';
+        }
+    }
+    return true;
+}
+
+void amountToString(const uint8_t *amount,
+                    uint8_t amount_size,
+                    uint8_t decimals,
+                    const char *ticker,
+                    char *out_buffer,
+                    uint8_t out_buffer_size) {
+    char tmp_buffer[100] = {0};
+
+    if (!uint256_to_decimal(amount, amount_size, tmp_buffer, sizeof(tmp_buffer))) {
+        // The device throws 0x6504 here.
+        strlcpy(out_buffer, "", out_buffer_size);
+        return;
+    }
+
+    uint8_t amount_len = strnlen(tmp_buffer, sizeof(tmp_buffer));
+    uint8_t ticker_len = strnlen(ticker, MAX_TICKER_LEN);
+
+    memcpy(out_buffer, ticker, MIN(out_buffer_size, ticker_len));
+    if (ticker_len > 0) {
+        out_buffer[ticker_len++] = ' ';
+    }
+
+    adjustDecimals(tmp_buffer,
+                   amount_len,
+                   out_buffer + ticker_len,
+                   out_buffer_size - ticker_len - 1,
+                   decimals);
+    out_buffer[out_buffer_size - 1] = '\0';
+}
+
+// EIP-55 checksummed address, without the "0x" prefix.
+void getEthAddressStringFromBinary(uint8_t *address,
+                                   char *out,
+                                   cx_sha3_t *sha3Context,
+                                   uint64_t chainId) {
+    uint8_t hashChecksum[INT256_LENGTH];
+    char lower[2 * ADDRESS_LENGTH];
+
+    (void) chainId;  // EIP-1191 (RSK) is not supported by the host build.
+    for (int i = 0; i < ADDRESS_LENGTH; i++) {
+        lower[2 * i] = HEXDIGITS[(address[i] >> 4) & 0x0f];
+        lower[2 * i + 1] = HEXDIGITS[address[i] & 0x0f];
+    }
+    cx_keccak_256(sha3Context, (const uint8_t *) lower, sizeof(lower), hashChecksum);
+
+    for (int i = 0; i < 2 * ADDRESS_LENGTH; i++) {
+        uint8_t hash_nibble = (hashChecksum[i / 2] >> (4 * (1 - i % 2))) & 0x0f;
+        if (lower[i] >= 'a' && hash_nibble >= 8) {
+            out[i] = (char) (lower[i] - 'a' + 'A');
+        } else {
+            out[i] = lower[i];
+        }
+    }
+    out[2 * ADDRESS_LENGTH] = '\0';
+}
+
+unsigned int host_amount_too_long;
+
+void nvm_write(void *dst, void *src, unsigned int len) {
+    if (src == NULL) {
+        memset(dst, 0, len);
+    } else {
+        memcpy(dst, src, len);
+    }
+}
@@ -0,0 +1,66 @@
+// Host stand-in for ethereum-plugin-sdk/include/eth_internals.h: the transaction and token
+// structures and the helpers the handlers call, implemented in eth_internals.c.
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "os.h"
+#include "cx.h"
+
+#define ADDRESS_LENGTH   20
+#define INT256_LENGTH    32
+#define SELECTOR_SIZE    4
+#define PARAMETER_LENGTH 32
+#define MAX_TICKER_LEN   12  // 10 characters + ' ' + '\0'
+
+#define MIN(x, y) ((x) < (y) ? (x) : (y))
+
+typedef struct txInt256_t {
+    uint8_t value[INT256_LENGTH];
+    uint8_t length;
+} txInt256_t;
+
+typedef struct txContent_t {
+    txInt256_t gasprice;
+    txInt256_t startgas;
+    txInt256_t value;
+    txInt256_t nonce;
+    txInt256_t chainID;
+    uint8_t destination[ADDRESS_LENGTH];
+    uint8_t destinationLength;
+    uint8_t v[8];
+    uint8_t vLength;
+    bool dataPresent;
+} txContent_t;
+
+typedef struct tokenDefinition_t {
+    uint8_t address[ADDRESS_LENGTH];
+    char ticker[MAX_TICKER_LEN];
+    uint8_t decimals;
+} tokenDefinition_t;
+
+typedef union extraInfo_t {
+    tokenDefinition_t token;
+} extraInfo_t;
+
+void copy_address(uint8_t *dst, const uint8_t *parameter, uint8_t dst_size);
+void copy_parameter(uint8_t *dst, const uint8_t *parameter, uint8_t dst_size);
+bool uint256_to_decimal(const uint8_t *value, size_t value_len, char *out, size_t out_len);
+bool adjustDecimals(const char *src,
+                    size_t srcLength,
+                    char *target,
+                    size_t targetLength,
+                    uint8_t decimals);
+void amountToString(const uint8_t *amount,
+                    uint8_t amount_size,
+                    uint8_t decimals,
+                    const char *ticker,
+                    char *out_buffer,
+                    uint8_t out_buffer_size);
+void getEthAddressStringFromBinary(uint8_t *address,
+                                   char *out,
+                                   cx_sha3_t *sha3Context,
+                                   uint64_t chainId);
@@ -0,0 +1,118 @@
+// Host stand-in for ethereum-plugin-sdk/include/eth_plugin_interface.h. The structures follow the
+// layout used by app-ethereum so that the handlers in src/ compile unchanged.
+#pragma once
+
+#include "os.h"
+#include "cx.h"
+#include "eth_internals.h"
+
+typedef enum {
+    ETH_PLUGIN_INTERFACE_VERSION_1 = 1,
+    ETH_PLUGIN_INTERFACE_VERSION_2 = 2,
+    ETH_PLUGIN_INTERFACE_VERSION_LATEST = 2,
+} eth_plugin_interface_version_t;
+
+typedef enum {
+    ETH_PLUGIN_INIT_CONTRACT = 0x0101,
+    ETH_PLUGIN_PROVIDE_PARAMETER = 0x0102,
+    ETH_PLUGIN_FINALIZE = 0x0103,
+    ETH_PLUGIN_PROVIDE_INFO = 0x0104,
+    ETH_PLUGIN_QUERY_CONTRACT_ID = 0x0105,
+    ETH_PLUGIN_QUERY_CONTRACT_UI = 0x0106,
+    ETH_PLUGIN_CHECK_PRESENCE = 0x01FF,
+} eth_plugin_msg_t;
+
+typedef enum {
+    ETH_PLUGIN_RESULT_ERROR = 0x00,
+    ETH_PLUGIN_RESULT_UNAVAILABLE = 0x01,
+    ETH_PLUGIN_RESULT_UNSUCCESSFUL = 0x02,
+    ETH_PLUGIN_RESULT_SUCCESSFUL = 0x03,
+    ETH_PLUGIN_RESULT_OK = 0x04,
+    ETH_PLUGIN_RESULT_OK_ALIAS = 0x05,
+    ETH_PLUGIN_RESULT_FALLBACK = 0x06,
+} eth_plugin_result_t;
+
+typedef enum {
+    ETH_UI_TYPE_AMOUNT_ADDRESS = 0x01,
+    ETH_UI_TYPE_GENERIC = 0x02,
+} eth_ui_type_t;
+
+#define PLUGIN_CONTEXT_SIZE (5 * INT256_LENGTH)
+
+typedef struct ethPluginSharedRW_t {
+    cx_sha3_t *sha3;
+} ethPluginSharedRW_t;
+
+typedef struct ethPluginSharedRO_t {
+    txContent_t *txContent;
+} ethPluginSharedRO_t;
+
+typedef struct ethPluginInitContract_t {
+    uint8_t interfaceVersion;
+    uint8_t result;
+    ethPluginSharedRW_t *pluginSharedRW;
+    ethPluginSharedRO_t *pluginSharedRO;
+    uint8_t *pluginContext;
+    size_t pluginContextLength;
+    const uint8_t *selector;
+    size_t dataSize;
+    char *alias;
+} ethPluginInitContract_t;
+
+typedef struct ethPluginProvideParameter_t {
+    ethPluginSharedRW_t *pluginSharedRW;
+    ethPluginSharedRO_t *pluginSharedRO;
+    uint8_t *pluginContext;
+    const uint8_t *parameter;
+    uint32_t parameterOffset;
+    uint8_t result;
+} ethPluginProvideParameter_t;
+
+typedef struct ethPluginFinalize_t {
+    ethPluginSharedRW_t *pluginSharedRW;
+    ethPluginSharedRO_t *pluginSharedRO;
+    uint8_t *pluginContext;
+    uint8_t *tokenLookup1;
+    uint8_t *tokenLookup2;
+    uint8_t *amount;
+    uint8_t *address;
+    uint8_t uiType;
+    uint8_t numScreens;
+    uint8_t result;
+} ethPluginFinalize_t;
+
+typedef struct ethPluginProvideInfo_t {
+    ethPluginSharedRW_t *pluginSharedRW;
+    ethPluginSharedRO_t *pluginSharedRO;
+    uint8_t *pluginContext;
+    extraInfo_t *item1;
+    extraInfo_t *item2;
+    uint8_t additionalScreens;
+    uint8_t result;
+} ethPluginProvideInfo_t;
+
+typedef struct ethQueryContractID_t {
+    ethPluginSharedRW_t *pluginSharedRW;
+    ethPluginSharedRO_t *pluginSharedRO;
+    uint8_t *pluginContext;
+    char *name;
+    size_t nameLength;
+    char *version;
+    size_t versionLength;
+    uint8_t result;
+} ethQueryContractID_t;
+
+typedef struct ethQueryContractUI_t {
+    ethPluginSharedRW_t *pluginSharedRW;
+    ethPluginSharedRO_t *pluginSharedRO;
+    extraInfo_t *item1;
+    extraInfo_t *item2;
+    char network_ticker[MAX_TICKER_LEN];
+    uint8_t *pluginContext;
+    uint8_t screenIndex;
+    char *title;
+    size_t titleLength;
+    char *msg;
+    size_t msgLength;
+    uint8_t result;
+} ethQueryContractUI_t;
@@ -0,0 +1,20 @@
+// Host stand-in for the BOLOS os.h.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PIC(x) ((uintptr_t) (x))
+
+#define PRINTF(...)
+#define PRINTF_TRACE(...)
+#define PRINTF_FLUSH()
+
+// Screens whose amount did not fit, counted by AMOUNT_TOO_LONG in handle_query_contract_ui.c.
+extern unsigned int host_amount_too_long;
+#define AMOUNT_TOO_LONG() host_amount_too_long++
+
+size_t strlcpy(char *dst, const char *src, size_t size);
+
+// NVM is plain memory on the host: N_ variables are defined in a writable section.
+void nvm_write(void *dst, void *src, unsigned int len);
@@ -0,0 +1,385 @@
+// Golden text of every transaction of vectors.c, i.e. of every Zemu test in tests/src: the
+// plugin's name/version and the exact title and message of each of its screens. It checks the
+// same logic as the Speculos snapshots, in milliseconds; Speculos is still needed for the
+// Ethereum app's own screens and for the layout.
+//
+// Every vector must have an entry here and every selector of YEARN_SELECTORS must be reached by
+// one of them.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vectors.h"
+
+#define RECIPIENT "0xB8c93dF4E1e6b1097889554D9294Dfb42814063a"
+
+typedef struct golden_screen_t {
+    const char *title;
+    const char *msg;
+} golden_screen_t;
+
+typedef struct golden_t {
+    const char *vector;  // host_vector_t.name
+    const char *name;
+    const char *version;
+    uint8_t num_screens;
+    golden_screen_t screens[MAX_SCREENS];
+} golden_t;
+
+static const golden_t GOLDEN[] = {
+    {"deposit_all", "Yearn", "Deposit", 2, {{"Amount", "ALL"}, {"Vault", "yvUSDC"}}},
+    {"deposit_18_decimals",
+     "Yearn",
+     "Deposit",
+     2,
+     {{"Amount", "345.123456789352738273 HUSD"}, {"Vault", "yvCurve-HUSD"}}},
+    {"deposit_18_decimals_to",
+     "Yearn",
+     "Deposit",
+     3,
+     {{"Amount", "345.123456789352738273 HUSD"},
+      {"Vault", "yvCurve-HUSD"},
+      {"Recipient", RECIPIENT}}},
+    {"deposit_6_decimals",
+     "Yearn",
+     "Deposit",
+     2,
+     {{"Amount", "60 USDC"}, {"Vault", "yvUSDC"}}},
+    {"deposit_6_decimals_to",
+     "Yearn",
+     "Deposit",
+     3,
+     {{"Amount", "60 USDC"}, {"Vault", "yvUSDC"}, {"Recipient", RECIPIENT}}},
+    {"deposit_8_decimals",
+     "Yearn",
+     "Deposit",
+     2,
+     {{"Amount", "2.12345678 WBTC"}, {"Vault", "yvWBTC"}}},
+    {"deposit_8_decimals_to",
+     "Yearn",
+     "Deposit",
+     3,
+     {{"Amount", "2.12345678 WBTC"}, {"Vault", "yvWBTC"}, {"Recipient", RECIPIENT}}},
+    {"withdraw_all", "Yearn", "Withdraw", 2, {{"Amount", "ALL"}, {"Vault", "yvUSDC"}}},
+    {"withdraw_18_decimals",
+     "Yearn",
+     "Withdraw",
+     2,
+     {{"Amount", "345.123456789352738273 yvCurve-HUSD"}, {"Vault", "yvCurve-HUSD"}}},
+    {"withdraw_18_decimals_to",
+     "Yearn",
+     "Withdraw",
+     3,
+     {{"Amount", "345.123456789352738273 yvCurve-HUSD"},
+      {"Vault", "yvCurve-HUSD"},
+      {"Recipient", RECIPIENT}}},
+    {"withdraw_18_decimals_to_slippage",
+     "Yearn",
+     "Withdraw",
+     4,
+     {{"Amount", "345.123456789352738273 yvCurve-HUSD"},
+      {"Vault", "yvCurve-HUSD"},
+      {"Recipient", RECIPIENT},
+      {"Slippage", "10 %"}}},
+    {"withdraw_6_decimals",
+     "Yearn",
+     "Withdraw",
+     2,
+     {{"Amount", "60 yvUSDC"}, {"Vault", "yvUSDC"}}},
+    {"withdraw_6_decimals_to",
+     "Yearn",
+     "Withdraw",
+     3,
+     {{"Amount", "60 yvUSDC"}, {"Vault", "yvUSDC"}, {"Recipient", RECIPIENT}}},
+    {"withdraw_6_decimals_to_slippage",
+     "Yearn",
+     "Withdraw",
+     4,
+     {{"Amount", "60 yvUSDC"},
+      {"Vault", "yvUSDC"},
+      {"Recipient", RECIPIENT},
+      {"Slippage", "10 %"}}},
+    {"withdraw_8_decimals",
+     "Yearn",
+     "Withdraw",
+     2,
+     {{"Amount", "2.12345678 yvWBTC"}, {"Vault", "yvWBTC"}}},
+    {"withdraw_8_decimals_to",
+     "Yearn",
+     "Withdraw",
+     3,
+     {{"Amount", "2.12345678 yvWBTC"}, {"Vault", "yvWBTC"}, {"Recipient", RECIPIENT}}},
+    {"withdraw_8_decimals_to_slippage",
+     "Yearn",
+     "Withdraw",
+     4,
+     {{"Amount", "2.12345678 yvWBTC"},
+      {"Vault", "yvWBTC"},
+      {"Recipient", RECIPIENT},
+      {"Slippage", "10 %"}}},
+    {"erc4626_mint",
+     "Yearn",
+     "Deposit",
+     3,
+     {{"Amount", "60 yvUSDC-1"}, {"Vault", "yvUSDC-1"}, {"Recipient", RECIPIENT}}},
+    {"erc4626_withdraw",
+     "Yearn",
+     "Withdraw",
+     4,
+     {{"Amount", "60 USDC"},
+      {"Vault", "yvUSDC-1"},
+      {"Recipient", RECIPIENT},
+      {"Owner", RECIPIENT}}},
+    {"erc4626_redeem", "Yearn", "Withdraw", 2, {{"Amount", "60 yvUSDC-1"}, {"Vault", "yvUSDC-1"}}},
+    {"router_deposit",
+     "Yearn",
+     "Deposit",
+     3,
+     {{"Amount", "60 USDC"}, {"Vault", "yvUSDC"}, {"Recipient", RECIPIENT}}},
+    {"router_mint",
+     "Yearn",
+     "Deposit",
+     3,
+     {{"Amount", "2.12345678 yvWBTC"}, {"Vault", "yvWBTC"}, {"Recipient", RECIPIENT}}},
+    {"router_withdraw",
+     "Yearn",
+     "Withdraw",
+     3,
+     {{"Amount", "345.123456789352738273 HUSD"},
+      {"Vault", "yvCurve-HUSD"},
+      {"Recipient", RECIPIENT}}},
+    {"router_redeem",
+     "Yearn",
+     "Withdraw",
+     3,
+     {{"Amount", "60 yvUSDC"}, {"Vault", "yvUSDC"}, {"Recipient", RECIPIENT}}},
+    {"router_multicall",
+     "Yearn",
+     "Batch",
+     4,
+     {{"Call 1/3", "Deposit 60 USDC, yvUSDC"},
+      {"Call 2/3", "Withdraw 345.123456789352738273 HUSD, yvCurve-HUSD"},
+      {"Call 3/3", "Withdraw 2.12345678 yvWBTC, yvWBTC"},
+      {"Recipient", RECIPIENT}}},
+    {"yveCRV_deposit",
+     "Yearn",
+     "Deposit",
+     2,
+     {{"Amount", "2793.487133607116325965 CRV"}, {"Vault", "yveCRV"}}},
+    {"yveCRV_deposit_all", "Yearn", "Deposit", 2, {{"Amount", "ALL"}, {"Vault", "yveCRV"}}},
+    {"zap_in_usdc_sushi",
+     "Yearn",
+     "Zap In",
+     2,
+     {{"Amount", "50000 USDC"}, {"Vault", "yvSUSHI"}}},
+    {"zap_in_eth_weth", "Yearn", "Zap In", 2, {{"Amount", "3 ETH"}, {"Vault", "yvWETH"}}},
+    {"zap_in_usdc_pickle",
+     "Yearn",
+     "Zap In",
+     2,
+     {{"Amount", "71362.605101 USDC"}, {"Vault", "pSLPyvBOOST-ETH"}}},
+    {"zap_in_dai", "Yearn", "Zap In", 2, {{"Amount", "1000 DAI"}, {"Vault", "yvSUSHI"}}},
+    {"zap_in_unknown_vault",
+     "Yearn",
+     "Zap In",
+     2,
+     {{"Amount", "50000 USDC"}, {"Vault", "yvNEW"}}},
+    {"ib_mint",
+     "IronBank",
+     "Supply",
+     2,
+     {{"Amount", "39346.97098625 CUSDC"}, {"Market", "cyCUSDC"}}},
+    {"ib_redeem",
+     "IronBank",
+     "Redeem",
+     2,
+     {{"Amount", "490.60354905 cyWETH"}, {"Market", "cyWETH"}}},
+    {"ib_redeem_underlying",
+     "IronBank",
+     "Redeem",
+     2,
+     {{"Amount", "1.002294609835133971 WETH"}, {"Market", "cyWETH"}}},
+    {"ib_borrow",
+     "IronBank",
+     "Borrow",
+     2,
+     {{"Amount", "43589 cyCUSDC"}, {"Market", "cyCUSDC"}}},
+    {"ib_repay_borrow",
+     "IronBank",
+     "Repay",
+     2,
+     {{"Amount", "43589 cyCUSDC"}, {"Market", "cyCUSDC"}}},
+    {"yveCRV_claim", "Yearn", "Claim", 2, {{"Amount", "ALL"}, {"Vault", "yveCRV"}}},
+    {"pickle_exit", "Yearn", "Exit", 2, {{"Amount", "ALL"}, {"Vault", "pSLPyvBOOST-ETH"}}},
+    {"pickle_getRewards",
+     "Yearn",
+     "Claim",
+     2,
+     {{"Amount", "ALL"}, {"Vault", "pSLPyvBOOST-ETH"}}},
+};
+
+#define GOLDEN_COUNT (sizeof(GOLDEN) / sizeof(GOLDEN[0]))
+
+#define UNKNOWN_VAULT "0000000000000000000000004444444444444444444444444444444444444444"
+
+#define ROUTER_TAIL                                                    \
+    "0000000000000000000000000000000000000000000000000de0b6b3a7640000" \
+    "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a" \
+    "0000000000000000000000000000000000000000000000000000000000000000"
+
+// Router calls to a vault that is not in the tables, refused at FINALIZE: nothing would name the
+// vault, nor give the decimals and ticker of the amount.
+static const host_vector_t UNKNOWN_VAULTS[] = {
+    {"router_deposit_unknown",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "90d25074" UNKNOWN_VAULT ROUTER_TAIL},
+    {"router_mint_unknown",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "3c173a4f" UNKNOWN_VAULT ROUTER_TAIL},
+    {"router_withdraw_unknown",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "4b2084e3" UNKNOWN_VAULT ROUTER_TAIL},
+    {"router_redeem_unknown",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "f3f094a1" UNKNOWN_VAULT ROUTER_TAIL},
+};
+
+#define UNKNOWN_VAULTS_COUNT (sizeof(UNKNOWN_VAULTS) / sizeof(UNKNOWN_VAULTS[0]))
+
+static int failures;
+
+static void fail(const char *vector, const char *message) {
+    fprintf(stderr, "%s: %s\n", vector, message);
+    failures++;
+}
+
+static void expect_str(const char *vector,
+                       const char *what,
+                       const char *actual,
+                       const char *expected) {
+    if (strcmp(actual, expected) != 0) {
+        fprintf(stderr, "%s: %s \"%s\", expected \"%s\"\n", vector, what, actual, expected);
+        failures++;
+    }
+}
+
+static const golden_t *find_golden(const char *vector) {
+    for (size_t i = 0; i < GOLDEN_COUNT; i++) {
+        if (strcmp(GOLDEN[i].vector, vector) == 0) {
+            return &GOLDEN[i];
+        }
+    }
+    return NULL;
+}
+
+// Runs `vector` and compares everything displayed with `golden`. Returns the selector index.
+static int check_vector(const host_vector_t *vector, const golden_t *golden) {
+    static uint8_t calldata[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+    size_t calldata_len;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+    uint8_t result;
+
+    if (!host_vector_load(vector, &tx, calldata, sizeof(calldata), &calldata_len)) {
+        fail(vector->name, "invalid vector");
+        return -1;
+    }
+    result = host_tx_run(&tx, calldata, calldata_len);
+    if (result != ETH_PLUGIN_RESULT_OK || tx.ui_type != ETH_UI_TYPE_GENERIC) {
+        fprintf(stderr, "%s: result %d, UI type %d\n", vector->name, result, tx.ui_type);
+        failures++;
+        return -1;
+    }
+    if (tx.num_screens != golden->num_screens) {
+        fprintf(stderr,
+                "%s: %d screens, expected %d\n",
+                vector->name,
+                tx.num_screens,
+                golden->num_screens);
+        failures++;
+    }
+
+    if (host_tx_query_id(&tx, title, sizeof(title), msg, sizeof(msg)) != ETH_PLUGIN_RESULT_OK) {
+        fail(vector->name, "QUERY_CONTRACT_ID failed");
+    }
+    expect_str(vector->name, "name", title, golden->name);
+    expect_str(vector->name, "version", msg, golden->version);
+
+    for (uint8_t i = 0; i < tx.num_screens && i < golden->num_screens; i++) {
+        if (host_tx_query_ui(&tx, i, title, sizeof(title), msg, sizeof(msg)) !=
+            ETH_PLUGIN_RESULT_OK) {
+            fprintf(stderr, "%s: screen %d failed\n", vector->name, i);
+            failures++;
+            continue;
+        }
+        expect_str(vector->name, "title", title, golden->screens[i].title);
+        expect_str(vector->name, "msg", msg, golden->screens[i].msg);
+    }
+    if (host_tx_query_ui(&tx, tx.num_screens, title, sizeof(title), msg, sizeof(msg)) !=
+        ETH_PLUGIN_RESULT_ERROR) {
+        fail(vector->name, "screen past numScreens accepted");
+    }
+    return ((const context_t *) tx.context)->selectorIndex;
+}
+
+static void check_unknown_vault(const host_vector_t *vector) {
+    static uint8_t calldata[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+    size_t calldata_len;
+
+    if (!host_vector_load(vector, &tx, calldata, sizeof(calldata), &calldata_len)) {
+        fail(vector->name, "invalid vector");
+    } else if (host_tx_run(&tx, calldata, calldata_len) != ETH_PLUGIN_RESULT_ERROR) {
+        fail(vector->name, "unknown vault accepted");
+    }
+}
+
+int main(void) {
+    bool reached[NUM_SELECTORS] = {false};
+
+    for (size_t i = 0; i < HOST_VECTORS_COUNT; i++) {
+        const golden_t *golden = find_golden(HOST_VECTORS[i].name);
+        if (golden == NULL) {
+            fail(HOST_VECTORS[i].name, "no golden text");
+            continue;
+        }
+        int selector = check_vector(&HOST_VECTORS[i], golden);
+        if (selector >= 0 && selector < NUM_SELECTORS) {
+            reached[selector] = true;
+        }
+    }
+    for (size_t i = 0; i < UNKNOWN_VAULTS_COUNT; i++) {
+        check_unknown_vault(&UNKNOWN_VAULTS[i]);
+    }
+    for (size_t i = 0; i < GOLDEN_COUNT; i++) {
+        bool found = false;
+        for (size_t j = 0; j < HOST_VECTORS_COUNT && !found; j++) {
+            found = strcmp(HOST_VECTORS[j].name, GOLDEN[i].vector) == 0;
+        }
+        if (!found) {
+            fail(GOLDEN[i].vector, "no such vector");
+        }
+    }
+    for (uint8_t i = 0; i < NUM_SELECTORS; i++) {
+        if (!reached[i]) {
+            fprintf(stderr,
+                    "selector %02x%02x%02x%02x (index %d) has no vector\n",
+                    YEARN_SELECTORS[i][0],
+                    YEARN_SELECTORS[i][1],
+                    YEARN_SELECTORS[i][2],
+                    YEARN_SELECTORS[i][3],
+                    i);
+            failures++;
+        }
+    }
+
+    if (failures != 0) {
+        fprintf(stderr, "%d failure(s)\n", failures);
+        return 1;
+    }
+    printf("ok, %zu transactions\n", HOST_VECTORS_COUNT);
+    return 0;
+}
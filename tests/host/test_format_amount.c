@@ -0,0 +1,157 @@
+// Differential test of `format_amount` against amountToString (sdk/eth_internals.c follows the
+// app-ethereum implementation), on edge cases and random amounts.
+//
+//   ./tests/host/build/test_format_amount [iterations] [seed]
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_plugin.h"
+
+#define DEFAULT_ITERATIONS 1000000
+#define OUT_SIZE           100
+
+static int failures;
+
+static uint64_t rng_state;
+
+// xorshift64*, so that a failure can be replayed from its seed.
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static void print_amount(const uint8_t *amount, uint8_t amount_size) {
+    fprintf(stderr, "0x");
+    for (uint8_t i = 0; i < amount_size; i++) {
+        fprintf(stderr, "%02x", amount[i]);
+    }
+}
+
+static void check(const uint8_t *amount, uint8_t amount_size, uint8_t decimals) {
+    char expected[OUT_SIZE], actual[OUT_SIZE];
+
+    memset(expected, 0, sizeof(expected));
+    amountToString(amount, amount_size, decimals, "", expected, sizeof(expected));
+    if (expected[0] == '\0') {
+        return;  // Does not fit, amountToString leaves the buffer untouched.
+    }
+    if (!format_amount(amount, amount_size, decimals, actual, sizeof(actual)) ||
+        strcmp(actual, expected) != 0) {
+        if (failures++ < 10) {
+            print_amount(amount, amount_size);
+            fprintf(stderr,
+                    " decimals %d: got \"%s\", expected \"%s\"\n",
+                    decimals,
+                    actual,
+                    expected);
+        }
+        return;
+    }
+
+    // A smaller buffer either fails with an empty string or gets the whole result.
+    size_t out_size = 1 + rng_next() % sizeof(actual);
+    char *small = malloc(out_size);
+    if (format_amount(amount, amount_size, decimals, small, out_size)
+            ? strcmp(small, expected) != 0
+            : small[0] != '\0' || strlen(expected) < out_size) {
+        if (failures++ < 10) {
+            print_amount(amount, amount_size);
+            fprintf(stderr,
+                    " decimals %d, out_size %zu: got \"%s\", expected \"%s\"\n",
+                    decimals,
+                    out_size,
+                    small,
+                    expected);
+        }
+    }
+    free(small);
+}
+
+// All decimals that matter for `amount`: around its digit count, common token decimals and 0.
+static void check_all_decimals(const uint8_t *amount, uint8_t amount_size) {
+    static const uint8_t common[] = {0, 1, 2, 6, 8, 9, 18, 24, 36, 77, 78, 79, 80, 96, 255};
+    for (size_t i = 0; i < sizeof(common); i++) {
+        check(amount, amount_size, common[i]);
+    }
+    check(amount, amount_size, rng_next() % 100);
+}
+
+static void check_edge_cases(void) {
+    uint8_t amount[INT256_LENGTH];
+
+    // 0, 1, all ones over every width, and every single byte set.
+    for (uint8_t size = 0; size <= INT256_LENGTH; size++) {
+        memset(amount, 0, sizeof(amount));
+        check_all_decimals(amount, size);
+        if (size > 0) {
+            amount[size - 1] = 1;
+            check_all_decimals(amount, size);
+        }
+        memset(amount, 0xff, size);
+        check_all_decimals(amount, size);
+    }
+    for (uint8_t byte = 0; byte < INT256_LENGTH; byte++) {
+        memset(amount, 0, sizeof(amount));
+        amount[byte] = 0x80;
+        check_all_decimals(amount, sizeof(amount));
+    }
+
+    // Powers of ten and their neighbours, up to 10^77 (the largest fitting in 256 bits).
+    uint8_t power[INT256_LENGTH] = {0};
+    power[INT256_LENGTH - 1] = 1;
+    for (int exponent = 0; exponent <= 77; exponent++) {
+        memcpy(amount, power, sizeof(amount));
+        check_all_decimals(amount, sizeof(amount));
+        for (int i = INT256_LENGTH - 1; i >= 0 && amount[i]-- == 0; i--) {
+        }
+        check_all_decimals(amount, sizeof(amount));
+        memcpy(amount, power, sizeof(amount));
+        for (int i = INT256_LENGTH - 1; i >= 0 && ++amount[i] == 0; i--) {
+        }
+        check_all_decimals(amount, sizeof(amount));
+
+        unsigned carry = 0;
+        for (int i = INT256_LENGTH - 1; i >= 0; i--) {
+            carry += power[i] * 10u;
+            power[i] = carry & 0xff;
+            carry >>= 8;
+        }
+    }
+}
+
+// Random amounts of random bit length, so that small values are as frequent as large ones.
+static void check_random(unsigned iterations) {
+    uint8_t amount[INT256_LENGTH];
+
+    for (unsigned n = 0; n < iterations; n++) {
+        for (size_t i = 0; i < sizeof(amount); i += 8) {
+            uint64_t word = rng_next();
+            memcpy(amount + i, &word, 8);
+        }
+        unsigned bits = rng_next() % 257;
+        for (unsigned i = 0; i < INT256_LENGTH * 8 - bits; i++) {
+            amount[i / 8] &= ~(0x80 >> (i % 8));
+        }
+        uint8_t amount_size = INT256_LENGTH - (rng_next() % 4 == 0 ? rng_next() % 24 : 0);
+        uint8_t decimals = rng_next() % 4 == 0 ? rng_next() % 100 : (rng_next() % 2 ? 18 : 6);
+        check(amount + INT256_LENGTH - amount_size, amount_size, decimals);
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned iterations = argc > 1 ? (unsigned) strtoul(argv[1], NULL, 10) : DEFAULT_ITERATIONS;
+    uint64_t seed = argc > 2 ? strtoull(argv[2], NULL, 0) : 0x5eed;
+
+    rng_state = seed != 0 ? seed : 1;
+    check_edge_cases();
+    check_random(iterations);
+
+    if (failures != 0) {
+        fprintf(stderr, "%d failure(s), seed 0x%llx\n", failures, (unsigned long long) seed);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
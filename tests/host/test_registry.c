@@ -0,0 +1,264 @@
+// Loads the signed update of tests/registry through `handle_registry_apdu`, as the Speculos test
+// does over APDUs, and checks that its vaults are then displayed like built-in ones.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_plugin.h"
+
+static int failures;
+
+#define EXPECT_STR(actual, expected)                        \
+    do {                                                    \
+        if (strcmp((actual), (expected)) != 0) {            \
+            fprintf(stderr,                                 \
+                    "%s:%d: got \"%s\", expected \"%s\"\n", \
+                    __FILE__,                               \
+                    __LINE__,                               \
+                    (actual),                               \
+                    (expected));                            \
+            failures++;                                     \
+        }                                                   \
+    } while (0)
+
+#define EXPECT_INT(actual, expected)                \
+    do {                                            \
+        if ((actual) != (expected)) {               \
+            fprintf(stderr,                         \
+                    "%s:%d: got %x, expected %x\n", \
+                    __FILE__,                       \
+                    __LINE__,                       \
+                    (int) (actual),                 \
+                    (int) (expected));              \
+            failures++;                             \
+        }                                           \
+    } while (0)
+
+// tools/sign_registry.py tests/registry/update.json tests/registry/test_key.hex: yvTEST
+// (0x3333..., 6 decimals) and yvCurve-TEST (0x1111...) vaults, cyTEST (0x2222...) market, on
+// chain 1, sequence 1.
+static const char UPDATE[] =
+    "59524e5201000000010000000000000001020100281111111111111111111111111111111111111111000000080012"
+    "000000000033333333333333333333333333333333333333330015001a00060000000000222222222222222222222"
+    "2222222222222222222001500210008000000000007637276544553540c797643757276652d544553540454455354"
+    "0679765445535406637954455354";
+static const char SIGNATURE[] =
+    "3045022100ea204de60ce7956e3c993e0510e639886a565c62c0e9c440e2b1d0f1b7e7acb602204380118a077ce5"
+    "c60e8f8994d3a4bb9d6c48e46639a90d272dc6317e3ce2c695";
+
+static uint8_t update[256];
+static size_t update_len;
+static uint8_t signature[72];
+static size_t signature_len;
+
+static uint16_t apdu(uint8_t ins,
+                     uint8_t p1,
+                     const uint8_t *data,
+                     size_t len,
+                     uint8_t *out,
+                     size_t *out_len) {
+    static uint8_t response[64];
+    size_t response_len;
+
+    return handle_registry_apdu(ins,
+                                p1,
+                                data,
+                                len,
+                                out == NULL ? response : out,
+                                out_len == NULL ? &response_len : out_len);
+}
+
+// Sends `len` bytes of `data` in chunks of `chunk` bytes. Returns the first status word that is
+// not SW_OK, or SW_OK.
+static uint16_t load(const uint8_t *data, size_t len, size_t chunk) {
+    for (size_t sent = 0; sent < len; sent += chunk) {
+        size_t size = len - sent < chunk ? len - sent : chunk;
+        uint16_t sw = apdu(INS_LOAD_REGISTRY,
+                           sent == 0 ? P1_FIRST_CHUNK : P1_NEXT_CHUNK,
+                           data + sent,
+                           size,
+                           NULL,
+                           NULL);
+        if (sw != SW_OK) {
+            return sw;
+        }
+    }
+    return SW_OK;
+}
+
+static uint8_t registry_valid(void) {
+    uint8_t info[64];
+    size_t info_len;
+
+    EXPECT_INT(apdu(INS_GET_REGISTRY, 0, NULL, 0, info, &info_len), SW_OK);
+    EXPECT_INT(info_len, 15);
+    return info[0];
+}
+
+// Runs `calldata` to `destination` on chain `chain_id` and checks its two screens.
+static void check_tx(const char *destination,
+                     uint8_t chain_id,
+                     const char *calldata,
+                     const char *amount,
+                     const char *vault) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+
+    host_parse_hex(destination, address, sizeof(address));
+    int data_len = host_parse_hex(calldata, data, sizeof(data));
+    host_tx_init(&tx, address, NULL, 0);
+    tx.content.chainID.value[0] = chain_id;
+    EXPECT_INT(host_tx_run(&tx, data, data_len), ETH_PLUGIN_RESULT_OK);
+    EXPECT_INT(tx.num_screens, 2);
+    EXPECT_INT(host_tx_query_ui(&tx, 0, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(msg, amount);
+    EXPECT_INT(host_tx_query_ui(&tx, 1, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(msg, vault);
+}
+
+static uint8_t init_result(const char *destination, const char *calldata) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+
+    host_parse_hex(destination, address, sizeof(address));
+    int data_len = host_parse_hex(calldata, data, sizeof(data));
+    host_tx_init(&tx, address, NULL, 0);
+    return host_tx_run(&tx, data, data_len);
+}
+
+// deposit(1000000) and Iron Bank mint(100000000).
+#define DEPOSIT "0xb6b55f2500000000000000000000000000000000000000000000000000000000000f4240"
+#define MINT    "0xa0712d680000000000000000000000000000000000000000000000000000000005f5e100"
+#define YV_TEST "0x3333333333333333333333333333333333333333"
+#define CY_TEST "0x2222222222222222222222222222222222222222"
+
+// multicall([deposit(yvTEST, 1000000, recipient, 0)]) of the Yearn 4626 Router.
+#define ROUTER_MULTICALL                                               \
+    "0xac9650d8"                                                       \
+    "0000000000000000000000000000000000000000000000000000000000000020" \
+    "0000000000000000000000000000000000000000000000000000000000000001" \
+    "0000000000000000000000000000000000000000000000000000000000000020" \
+    "0000000000000000000000000000000000000000000000000000000000000084" \
+    "90d25074"                                                         \
+    "0000000000000000000000003333333333333333333333333333333333333333" \
+    "00000000000000000000000000000000000000000000000000000000000f4240" \
+    "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a" \
+    "0000000000000000000000000000000000000000000000000000000000000000" \
+    "00000000000000000000000000000000000000000000000000000000"
+
+// Runs the multicall, then wipes the registry before its screens are queried: the vault of the
+// call is gone, and the call screen is refused.
+static void check_wiped_batch(void) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    uint8_t invalid = 0;
+    host_tx_t tx;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+
+    host_parse_hex("0x1112dbcf805682e828606f74ab717abf4b4fd8de", address, sizeof(address));
+    int data_len = host_parse_hex(ROUTER_MULTICALL, data, sizeof(data));
+    host_tx_init(&tx, address, NULL, 0);
+    EXPECT_INT(host_tx_run(&tx, data, data_len), ETH_PLUGIN_RESULT_OK);
+    EXPECT_INT(host_tx_query_ui(&tx, 0, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(msg, "Deposit 1 TEST, yvTEST");
+
+    nvm_write((void *) &N_registry.banks[N_registry.active & 1].valid, &invalid, sizeof(invalid));
+    EXPECT_INT(registry_valid(), 0);
+    EXPECT_INT(host_tx_query_ui(&tx, 0, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_ERROR);
+}
+
+int main(void) {
+    uint8_t tampered[sizeof(update)];
+    uint8_t out[64];
+    size_t out_len;
+
+    update_len = host_parse_hex(UPDATE, update, sizeof(update));
+    signature_len = host_parse_hex(SIGNATURE, signature, sizeof(signature));
+
+    // Not in the registry yet: refused at init, before any parameter.
+    EXPECT_INT(registry_valid(), 0);
+    EXPECT_INT(init_result(YV_TEST, DEPOSIT), ETH_PLUGIN_RESULT_UNAVAILABLE);
+
+    // A ticker changed after signing, a commit before the end of the update, a chunk past its end.
+    memcpy(tampered, update, update_len);
+    tampered[update_len - 1] ^= 1;
+    EXPECT_INT(load(tampered, update_len, 64), SW_OK);
+    EXPECT_INT(apdu(INS_COMMIT_REGISTRY, 0, signature, signature_len, NULL, NULL),
+               SW_SECURITY_STATUS);
+    EXPECT_INT(load(update, update_len - 1, 64), SW_OK);
+    EXPECT_INT(apdu(INS_COMMIT_REGISTRY, 0, signature, signature_len, NULL, NULL),
+               SW_CONDITIONS_NOT_SATISFIED);
+    memcpy(tampered + update_len, "x", 1);
+    EXPECT_INT(load(tampered, update_len + 1, 64), SW_WRONG_DATA);
+    EXPECT_INT(apdu(INS_LOAD_REGISTRY, P1_NEXT_CHUNK, update, 1, NULL, NULL),
+               SW_CONDITIONS_NOT_SATISFIED);
+    EXPECT_INT(registry_valid(), 0);
+
+    // In chunks that split the header and the entries.
+    EXPECT_INT(load(update, update_len, 7), SW_OK);
+    EXPECT_INT(apdu(INS_COMMIT_REGISTRY, 0, signature, signature_len, NULL, NULL), SW_OK);
+    EXPECT_INT(apdu(INS_GET_REGISTRY, 0, NULL, 0, out, &out_len), SW_OK);
+    EXPECT_INT(out_len, 15);
+    EXPECT_INT(memcmp(out, "\x01\0\0\0\x01\0\0\0\0\0\0\0\x01\x02\x01", 15), 0);
+
+    host_parse_hex(YV_TEST, tampered, ADDRESS_LENGTH);
+    EXPECT_INT(apdu(INS_GET_REGISTRY, 0, tampered, ADDRESS_LENGTH, out, &out_len), SW_OK);
+    EXPECT_INT(out_len, 1 + 5 + 7);
+    EXPECT_INT(out[0], 6);
+    EXPECT_INT(memcmp(out + 1, "\x04TEST\x06yvTEST", out_len - 1), 0);
+    EXPECT_INT(apdu(INS_GET_REGISTRY, 1, tampered, ADDRESS_LENGTH, out, &out_len), SW_NOT_FOUND);
+
+    check_tx(YV_TEST, 1, DEPOSIT, "1 TEST", "yvTEST");
+    check_tx(CY_TEST, 1, MINT, "1 TEST", "cyTEST");
+    check_tx("0x1111111111111111111111111111111111111111",
+             1,
+             "0xb6b55f250000000000000000000000000000000000000000000000000de0b6b3a7640000",
+             "1 crvTEST",
+             "yvCurve-TEST");
+    // Built-in vaults are unchanged, the update is only for its chain.
+    check_tx("0x054af22e1519b020516d72d749221c24756385c9",
+             1,
+             "0xb6b55f25000000000000000000000000000000000000000000000012b58cd368503eede1",
+             "345.123456789352738273 HUSD",
+             "yvCurve-HUSD");
+    check_tx(YV_TEST, 250, DEPOSIT, "1000000 ", "0x3333333333333333333333333333333333333333");
+
+    // The same update again, or an older one, is refused without touching the registry.
+    EXPECT_INT(load(update, update_len, 64), SW_CONDITIONS_NOT_SATISFIED);
+    EXPECT_INT(apdu(INS_COMMIT_REGISTRY, 0, signature, signature_len, NULL, NULL),
+               SW_CONDITIONS_NOT_SATISFIED);
+    EXPECT_INT(registry_valid(), 1);
+    check_tx(YV_TEST, 1, DEPOSIT, "1 TEST", "yvTEST");
+
+    // A newer header alone, or a newer update that is not signed, is loaded in the other bank: the
+    // registry in use is unchanged until a commit succeeds.
+    memcpy(tampered, update, update_len);
+    tampered[8] = 2;
+    EXPECT_INT(load(tampered, 21, 21), SW_OK);
+    EXPECT_INT(registry_valid(), 1);
+    check_tx(YV_TEST, 1, DEPOSIT, "1 TEST", "yvTEST");
+    EXPECT_INT(load(tampered, update_len, 64), SW_OK);
+    EXPECT_INT(apdu(INS_COMMIT_REGISTRY, 0, signature, signature_len, NULL, NULL),
+               SW_SECURITY_STATUS);
+    EXPECT_INT(registry_valid(), 1);
+    check_tx(YV_TEST, 1, DEPOSIT, "1 TEST", "yvTEST");
+    check_tx(CY_TEST, 1, MINT, "1 TEST", "cyTEST");
+
+    EXPECT_INT(apdu(0x42, 0, NULL, 0, NULL, NULL), SW_INS_NOT_SUPPORTED);
+
+    // Last: leaves the registry empty.
+    check_wiped_batch();
+
+    if (failures != 0) {
+        fprintf(stderr, "%d failure(s)\n", failures);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,363 @@
+// Runs a few transactions through the host build and checks what would be displayed.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vectors.h"
+
+static int failures;
+
+#define EXPECT_STR(actual, expected)                        \
+    do {                                                    \
+        if (strcmp((actual), (expected)) != 0) {            \
+            fprintf(stderr,                                 \
+                    "%s:%d: got \"%s\", expected \"%s\"\n", \
+                    __FILE__,                               \
+                    __LINE__,                               \
+                    (actual),                               \
+                    (expected));                            \
+            failures++;                                     \
+        }                                                   \
+    } while (0)
+
+#define EXPECT_INT(actual, expected)                \
+    do {                                            \
+        if ((actual) != (expected)) {               \
+            fprintf(stderr,                         \
+                    "%s:%d: got %d, expected %d\n", \
+                    __FILE__,                       \
+                    __LINE__,                       \
+                    (int) (actual),                 \
+                    (int) (expected));              \
+            failures++;                             \
+        }                                           \
+    } while (0)
+
+#define YV_WFTM       "0x0dec85e74a92c52b7f708c4b10207d9560cefaf0"
+#define YV_CURVE_HUSD "0x054af22e1519b020516d72d749221c24756385c9"
+
+typedef struct expected_screen_t {
+    const char *title;
+    const char *msg;
+} expected_screen_t;
+
+static void check_tx(const char *destination,
+                     const char *calldata,
+                     const tokenDefinition_t *tokens,
+                     size_t tokens_count,
+                     const char *name,
+                     const char *version,
+                     const expected_screen_t *screens,
+                     uint8_t num_screens) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+
+    int data_len = host_parse_hex(calldata, data, sizeof(data));
+    if (host_parse_hex(destination, address, sizeof(address)) != ADDRESS_LENGTH || data_len < 0) {
+        fprintf(stderr, "invalid test vector %s\n", calldata);
+        exit(1);
+    }
+
+    host_tx_init(&tx, address, tokens, tokens_count);
+    EXPECT_INT(host_tx_run(&tx, data, data_len), ETH_PLUGIN_RESULT_OK);
+    EXPECT_INT(tx.ui_type, ETH_UI_TYPE_GENERIC);
+    EXPECT_INT(tx.num_screens, num_screens);
+
+    EXPECT_INT(host_tx_query_id(&tx, title, sizeof(title), msg, sizeof(msg)), ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(title, name);
+    EXPECT_STR(msg, version);
+
+    // Forward, then back to the first screen: revisited screens must not change.
+    for (int step = 0; step < 2 * num_screens - 1; step++) {
+        uint8_t i = step < num_screens ? step : 2 * num_screens - 2 - step;
+        EXPECT_INT(host_tx_query_ui(&tx, i, title, sizeof(title), msg, sizeof(msg)),
+                   ETH_PLUGIN_RESULT_OK);
+        EXPECT_STR(title, screens[i].title);
+        EXPECT_STR(msg, screens[i].msg);
+    }
+}
+
+// The EIP-55 masks generated in the vault tables must give the same strings as the SDK.
+static void check_vault_checksums(const yearnVaultDefinition_t *vaults, size_t vaults_count) {
+    cx_sha3_t sha3;
+    char expected[ADDRESS_LENGTH * 2 + 1], actual[ADDRESS_LENGTH * 2 + 1];
+
+    for (size_t i = 0; i < vaults_count; i++) {
+        getEthAddressStringFromBinary((uint8_t *) vaults[i].address, expected, &sha3, 0);
+        address_to_checksummed_string(vaults[i].address, vaults[i].checksum, actual);
+        EXPECT_STR(actual, expected);
+    }
+}
+
+// Runs a deposit of 10^18 to `destination` on chain `chain_id` and checks its two screens: only
+// the vaults of that chain are resolved.
+static void check_chain(const char *destination,
+                        uint8_t chain_id,
+                        uint8_t chain_index,
+                        const char *amount,
+                        const char *vault) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+
+    host_parse_hex(destination, address, sizeof(address));
+    int data_len = host_parse_hex(
+        "0xb6b55f250000000000000000000000000000000000000000000000000de0b6b3a7640000",
+        data,
+        sizeof(data));
+    host_tx_init(&tx, address, NULL, 0);
+    tx.content.chainID.value[0] = chain_id;
+    EXPECT_INT(host_tx_run(&tx, data, data_len), ETH_PLUGIN_RESULT_OK);
+    EXPECT_INT(((const context_t *) tx.context)->chain_index, chain_index);
+    EXPECT_INT(host_tx_query_ui(&tx, 0, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(msg, amount);
+    EXPECT_INT(host_tx_query_ui(&tx, 1, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(title, "Vault");
+    EXPECT_STR(msg, vault);
+}
+
+// Runs the "zap_in_eth_weth" vector, 3 of the chain's coin sent as the null address, on chain
+// `chain_id`.
+static void check_native_ticker(uint8_t chain_id, const char *amount) {
+    static uint8_t calldata[HOST_MAX_CALLDATA];
+    size_t calldata_len = 0;
+    host_tx_t tx;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+
+    for (size_t i = 0; i < HOST_VECTORS_COUNT; i++) {
+        if (strcmp(HOST_VECTORS[i].name, "zap_in_eth_weth") == 0 &&
+            host_vector_load(&HOST_VECTORS[i], &tx, calldata, sizeof(calldata), &calldata_len)) {
+            break;
+        }
+    }
+    if (calldata_len == 0) {
+        fprintf(stderr, "no zap_in_eth_weth vector\n");
+        exit(1);
+    }
+    tx.content.chainID.value[0] = chain_id;
+    EXPECT_INT(host_tx_run(&tx, calldata, calldata_len), ETH_PLUGIN_RESULT_OK);
+    EXPECT_INT(host_tx_query_ui(&tx, 0, title, sizeof(title), msg, sizeof(msg)),
+               ETH_PLUGIN_RESULT_OK);
+    EXPECT_STR(msg, amount);
+}
+
+// Runs `calldata` on yvCurve-HUSD and displays its amount in a `msg_len` bytes buffer, too small
+// for it: the screen must fail rather than show the ticker alone.
+static void check_amount_too_long(const char *calldata, size_t msg_len) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+    char title[HOST_TITLE_LEN], msg[HOST_MSG_LEN];
+
+    host_parse_hex("0x054af22e1519b020516d72d749221c24756385c9", address, sizeof(address));
+    int data_len = host_parse_hex(calldata, data, sizeof(data));
+    host_tx_init(&tx, address, NULL, 0);
+    EXPECT_INT(host_tx_run(&tx, data, data_len), ETH_PLUGIN_RESULT_OK);
+    unsigned int amount_too_long = host_amount_too_long;
+    EXPECT_INT(host_tx_query_ui(&tx, 0, title, sizeof(title), msg, msg_len),
+               ETH_PLUGIN_RESULT_ERROR);
+    EXPECT_STR(msg, "");
+    EXPECT_INT(host_amount_too_long, amount_too_long + 1);
+}
+
+// Runs a transaction that the plugin must refuse with `result`: ETH_PLUGIN_RESULT_UNAVAILABLE at
+// init, ETH_PLUGIN_RESULT_ERROR while parsing its parameters.
+static void check_rejected(const char *destination, const char *calldata, uint8_t result) {
+    uint8_t address[ADDRESS_LENGTH];
+    uint8_t data[HOST_MAX_CALLDATA];
+    host_tx_t tx;
+
+    int data_len = host_parse_hex(calldata, data, sizeof(data));
+    if (host_parse_hex(destination, address, sizeof(address)) != ADDRESS_LENGTH || data_len < 0) {
+        fprintf(stderr, "invalid test vector %s\n", calldata);
+        exit(1);
+    }
+    host_tx_init(&tx, address, NULL, 0);
+    EXPECT_INT(host_tx_run(&tx, data, data_len), result);
+}
+
+// Runs the "router_multicall" vector with byte `pos` of the calldata set to `value`: the plugin
+// must refuse it. Word k of the calldata starts at 4 + 32 * k.
+static void check_multicall_rejected(size_t pos, uint8_t value) {
+    static uint8_t calldata[HOST_MAX_CALLDATA];
+    size_t calldata_len = 0;
+    host_tx_t tx;
+
+    for (size_t i = 0; i < HOST_VECTORS_COUNT; i++) {
+        if (strcmp(HOST_VECTORS[i].name, "router_multicall") == 0 &&
+            host_vector_load(&HOST_VECTORS[i], &tx, calldata, sizeof(calldata), &calldata_len)) {
+            break;
+        }
+    }
+    if (pos >= calldata_len) {
+        fprintf(stderr, "no router_multicall vector\n");
+        exit(1);
+    }
+    calldata[pos] = value;
+    uint8_t result = host_tx_run(&tx, calldata, calldata_len);
+    if (result == ETH_PLUGIN_RESULT_OK) {
+        fprintf(stderr, "multicall with byte %zu set to %d accepted\n", pos, value);
+        failures++;
+    }
+}
+
+int main(void) {
+    for (uint8_t i = 0; i < NUM_CHAINS; i++) {
+        check_vault_checksums(CHAINS[i].yearn_vaults, CHAINS[i].yearn_vaults_count);
+        check_vault_checksums(CHAINS[i].iron_bank, CHAINS[i].iron_bank_count);
+    }
+    // yvWFTM on Fantom (250), yvCurve-HUSD on Ethereum: each is only resolved on its own chain,
+    // and neither on Polygon (137), which has no table. Unresolved, the vault shows its address.
+    check_chain(YV_WFTM, 250, 1, "1 WFTM", "yvWFTM");
+    check_chain(YV_WFTM,
+                1,
+                0,
+                "1000000000000000000 ",
+                "0x0DEC85e74A92c52b7F708c4B10207D9560CEFaf0");
+    check_chain(YV_CURVE_HUSD,
+                250,
+                1,
+                "1000000000000000000 ",
+                "0x054AF22E1519b020516D72D749221c24756385C9");
+    check_chain(YV_CURVE_HUSD, 1, 0, "1 HUSD", "yvCurve-HUSD");
+    check_chain(YV_CURVE_HUSD,
+                137,
+                CHAIN_NOT_FOUND,
+                "1000000000000000000 ",
+                "0x054AF22E1519b020516D72D749221c24756385C9");
+    check_native_ticker(1, "3 ETH");
+    check_native_ticker(250, "3 FTM");
+    check_native_ticker(137, "3 ???");
+    // 345.12... HUSD in 8 bytes, 2^256 - 1 with 18 decimals (79 characters) in HOST_MSG_LEN.
+    check_amount_too_long(
+        "0xb6b55f25000000000000000000000000000000000000000000000012b58cd368503eede1",
+        8);
+    check_amount_too_long(
+        "0xb6b55f25ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+        HOST_MSG_LEN);
+
+    // Calls of a multicall: more than MAX_BATCH_CALLS, offset of the second call not where it is,
+    // amount over 96 bits, second recipient different from the first, unknown vault, padding.
+    check_multicall_rejected(4 + 32 * 1 + 31, 4);
+    check_multicall_rejected(4 + 32 * 3 + 31, 0x40);
+    check_multicall_rejected(4 + 32 * 7 + 4, 1);
+    check_multicall_rejected(4 + 32 * 14 + 31, 0);
+    check_multicall_rejected(4 + 32 * 19, 0);
+    check_multicall_rejected(4 + 32 * 22 + 31, 1);
+    // The slippage is kept in 16 bits: larger values (the vault would revert) are refused.
+    check_rejected("0x5f18c75abdae578b483e5f43f12a39cf75b973a9",
+                   "0xe63697c8"
+                   "00000000000000000000000000000000000000000000000000000000000f4240"
+                   "0000000000000000000000005aaeb6053f3e94c9b9a09f33669435e7ef1beaed"
+                   "0000000000000000000000000000000000000000000000000000000000010000",
+                   ETH_PLUGIN_RESULT_ERROR);
+    // deposit(uint256) with a second word: more words than the selector's params.
+    check_rejected("0x054af22e1519b020516d72d749221c24756385c9",
+                   "0xb6b55f25"
+                   "000000000000000000000000000000000000000000000012b58cd368503eede1"
+                   "0000000000000000000000000000000000000000000000000000000000000001",
+                   ETH_PLUGIN_RESULT_ERROR);
+    // Unknown selector on a known vault, known selectors on a contract missing from the registry.
+    check_rejected("0x5f18c75abdae578b483e5f43f12a39cf75b973a9",
+                   "0x12345678",
+                   ETH_PLUGIN_RESULT_UNAVAILABLE);
+    check_rejected("0x5aaeb6053f3e94c9b9a09f33669435e7ef1beaed",
+                   "0xb6b55f25"
+                   "000000000000000000000000000000000000000000000012b58cd368503eede1",
+                   ETH_PLUGIN_RESULT_UNAVAILABLE);
+    // The router and multicall selectors too, on anything but the router.
+    check_rejected("0x5aaeb6053f3e94c9b9a09f33669435e7ef1beaed",
+                   "0x90d25074"
+                   "0000000000000000000000005f18c75abdae578b483e5f43f12a39cf75b973a9"
+                   "0000000000000000000000000000000000000000000000000000000003938700"
+                   "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+                   "0000000000000000000000000000000000000000000000000000000000000000",
+                   ETH_PLUGIN_RESULT_UNAVAILABLE);
+    check_rejected("0x5aaeb6053f3e94c9b9a09f33669435e7ef1beaed",
+                   "0xac9650d8"
+                   "0000000000000000000000000000000000000000000000000000000000000020"
+                   "0000000000000000000000000000000000000000000000000000000000000000",
+                   ETH_PLUGIN_RESULT_UNAVAILABLE);
+    check_rejected("0x5aaeb6053f3e94c9b9a09f33669435e7ef1beaed",
+                   "0x38b32e68"
+                   "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+                   "0000000000000000000000000000000000000000000000000000000ba43b7400"
+                   "0000000000000000000000006d765cbe5bc922694afe112c140b8878b9fb0390",
+                   ETH_PLUGIN_RESULT_UNAVAILABLE);
+
+    // deposit(345123456789352738273) on yvCurve-HUSD.
+    const expected_screen_t deposit[] = {{"Amount", "345.123456789352738273 HUSD"},
+                                         {"Vault", "yvCurve-HUSD"}};
+    check_tx("0x054af22e1519b020516d72d749221c24756385c9",
+             "0xb6b55f25000000000000000000000000000000000000000000000012b58cd368503eede1",
+             NULL,
+             0,
+             "Yearn",
+             "Deposit",
+             deposit,
+             2);
+
+    // withdraw(1000000, 0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed, 50) on yvUSDC, 6 decimals.
+    const expected_screen_t withdraw[] = {
+        {"Amount", "1 yvUSDC"},
+        {"Vault", "yvUSDC"},
+        {"Recipient", "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed"},
+        {"Slippage", "0.5 %"}};
+    check_tx("0x5f18c75abdae578b483e5f43f12a39cf75b973a9",
+             "0xe63697c8"
+             "00000000000000000000000000000000000000000000000000000000000f4240"
+             "0000000000000000000000005aaeb6053f3e94c9b9a09f33669435e7ef1beaed"
+             "0000000000000000000000000000000000000000000000000000000000000032",
+             NULL,
+             0,
+             "Yearn",
+             "Withdraw",
+             withdraw,
+             4);
+
+    // ZapIn of 50000 USDC into yvSushi, the token ticker comes from PROVIDE_INFO.
+    const tokenDefinition_t usdc = {{0xa0, 0xb8, 0x69, 0x91, 0xc6, 0x21, 0x8b, 0x36, 0xc1, 0xd1,
+                                     0x9d, 0x4a, 0x2e, 0x9e, 0xb0, 0xce, 0x36, 0x06, 0xeb, 0x48},
+                                    "USDC",
+                                    6};
+    const expected_screen_t zap[] = {{"Amount", "50000 USDC"}, {"Vault", "yvSUSHI"}};
+    check_tx("0x92be6adb6a12da0ca607f9d87db2f9978cd6ec3e",
+             "0x38b32e68"
+             "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+             "0000000000000000000000000000000000000000000000000000000ba43b7400"
+             "0000000000000000000000006d765cbe5bc922694afe112c140b8878b9fb0390",
+             &usdc,
+             1,
+             "Yearn",
+             "Zap In",
+             zap,
+             2);
+
+    // The same ZapIn to a vault that is neither in the tables nor a token known to the Ethereum
+    // app: its address is displayed.
+    const expected_screen_t zap_unknown[] = {
+        {"Amount", "50000 USDC"},
+        {"Vault", "0x4444444444444444444444444444444444444444"}};
+    check_tx("0x92be6adb6a12da0ca607f9d87db2f9978cd6ec3e",
+             "0x38b32e68"
+             "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+             "0000000000000000000000000000000000000000000000000000000ba43b7400"
+             "0000000000000000000000004444444444444444444444444444444444444444",
+             &usdc,
+             1,
+             "Yearn",
+             "Zap In",
+             zap_unknown,
+             2);
+
+    if (failures != 0) {
+        fprintf(stderr, "%d failure(s)\n", failures);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
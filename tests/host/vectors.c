@@ -0,0 +1,418 @@
+#include "vectors.h"
+
+const host_vector_t HOST_VECTORS[] = {
+    {"deposit_all",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "d0e30db0"},
+    {"deposit_18_decimals",
+     "vault",
+     "054af22e1519b020516d72d749221c24756385c9",
+     "b6b55f25"
+     "000000000000000000000000000000000000000000000012b58cd368503eede1"},
+    {"deposit_18_decimals_to",
+     "vault",
+     "054af22e1519b020516d72d749221c24756385c9",
+     "6e553f65"
+     "000000000000000000000000000000000000000000000012b58cd368503eede1"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"deposit_6_decimals",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "b6b55f25"
+     "0000000000000000000000000000000000000000000000000000000003938700"},
+    {"deposit_6_decimals_to",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "6e553f65"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"deposit_8_decimals",
+     "vault",
+     "a696a63cc78dffa1a63e9e50587c197387ff6c7e",
+     "b6b55f25"
+     "000000000000000000000000000000000000000000000000000000000ca8234e"},
+    {"deposit_8_decimals_to",
+     "vault",
+     "a696a63cc78dffa1a63e9e50587c197387ff6c7e",
+     "6e553f65"
+     "000000000000000000000000000000000000000000000000000000000ca8234e"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"withdraw_all",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "3ccfd60b"},
+    {"withdraw_18_decimals",
+     "vault",
+     "054af22e1519b020516d72d749221c24756385c9",
+     "2e1a7d4d"
+     "000000000000000000000000000000000000000000000012b58cd368503eede1"},
+    {"withdraw_18_decimals_to",
+     "vault",
+     "054af22e1519b020516d72d749221c24756385c9",
+     "00f714ce"
+     "000000000000000000000000000000000000000000000012b58cd368503eede1"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"withdraw_18_decimals_to_slippage",
+     "vault",
+     "054af22e1519b020516d72d749221c24756385c9",
+     "e63697c8"
+     "000000000000000000000000000000000000000000000012b58cd368503eede1"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "00000000000000000000000000000000000000000000000000000000000003e8"},
+    {"withdraw_6_decimals",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "2e1a7d4d"
+     "0000000000000000000000000000000000000000000000000000000003938700"},
+    {"withdraw_6_decimals_to",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "00f714ce"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"withdraw_6_decimals_to_slippage",
+     "vault",
+     "5f18c75abdae578b483e5f43f12a39cf75b973a9",
+     "e63697c8"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "00000000000000000000000000000000000000000000000000000000000003e8"},
+    {"withdraw_8_decimals",
+     "vault",
+     "a696a63cc78dffa1a63e9e50587c197387ff6c7e",
+     "2e1a7d4d"
+     "000000000000000000000000000000000000000000000000000000000ca8234e"},
+    {"withdraw_8_decimals_to",
+     "vault",
+     "a696a63cc78dffa1a63e9e50587c197387ff6c7e",
+     "00f714ce"
+     "000000000000000000000000000000000000000000000000000000000ca8234e"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"withdraw_8_decimals_to_slippage",
+     "vault",
+     "a696a63cc78dffa1a63e9e50587c197387ff6c7e",
+     "e63697c8"
+     "000000000000000000000000000000000000000000000000000000000ca8234e"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "00000000000000000000000000000000000000000000000000000000000003e8"},
+    // ERC-4626 (Yearn V3) selectors, on yvUSDC-1. The withdraw burns the shares of the
+    // recipient, the redeem those of the sender.
+    {"erc4626_mint",
+     "erc4626",
+     "be53a109b494e5c9f97b9cd39fe969be68bf6204",
+     "94bf804d"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"erc4626_withdraw",
+     "erc4626",
+     "be53a109b494e5c9f97b9cd39fe969be68bf6204",
+     "b460af94"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"},
+    {"erc4626_redeem",
+     "erc4626",
+     "be53a109b494e5c9f97b9cd39fe969be68bf6204",
+     "ba087652"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000fe984369ce3919aa7bb4f431082d027b4f8ed70c"
+     "000000000000000000000000fe984369ce3919aa7bb4f431082d027b4f8ed70c"},
+    // Yearn 4626 Router calls: the vault comes from the calldata.
+    {"router_deposit",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "90d25074"
+     "0000000000000000000000005f18c75abdae578b483e5f43f12a39cf75b973a9"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {"router_mint",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "3c173a4f"
+     "000000000000000000000000a696a63cc78dffa1a63e9e50587c197387ff6c7e"
+     "000000000000000000000000000000000000000000000000000000000ca8234e"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {"router_withdraw",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "4b2084e3"
+     "000000000000000000000000054af22e1519b020516d72d749221c24756385c9"
+     "000000000000000000000000000000000000000000000012b58cd368503eede1"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "0000000000000000000000000000000000000000000000000000000000000001"},
+    {"router_redeem",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "f3f094a1"
+     "0000000000000000000000005f18c75abdae578b483e5f43f12a39cf75b973a9"
+     "0000000000000000000000000000000000000000000000000000000003938700"
+     "000000000000000000000000b8c93df4e1e6b1097889554d9294dfb42814063a"
+     "0000000000000000000000000000000000000000000000000000000000000001"},
+    {"router_multicall",
+     "router",
+     "1112dbcf805682e828606f74ab717abf4b4fd8de",
+     "ac9650d8"
+     "0000000000000000000000000000000000000000000000000000000000000020"
+     "0000000000000000000000000000000000000000000000000000000000000003"
+     "0000000000000000000000000000000000000000000000000000000000000060"
+     "0000000000000000000000000000000000000000000000000000000000000120"
+     "00000000000000000000000000000000000000000000000000000000000001e0"
+     "0000000000000000000000000000000000000000000000000000000000000084"
+     "90d250740000000000000000000000005f18c75abdae578b483e5f43f12a39cf"
+     "75b973a900000000000000000000000000000000000000000000000000000000"
+     "03938700000000000000000000000000b8c93df4e1e6b1097889554d9294dfb4"
+     "2814063a00000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000084"
+     "4b2084e3000000000000000000000000054af22e1519b020516d72d749221c24"
+     "756385c9000000000000000000000000000000000000000000000012b58cd368"
+     "503eede1000000000000000000000000b8c93df4e1e6b1097889554d9294dfb4"
+     "2814063a00000000000000000000000000000000000000000000000000000000"
+     "0000000100000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000084"
+     "f3f094a1000000000000000000000000a696a63cc78dffa1a63e9e50587c1973"
+     "87ff6c7e00000000000000000000000000000000000000000000000000000000"
+     "0ca8234e000000000000000000000000b8c93df4e1e6b1097889554d9294dfb4"
+     "2814063a00000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {"yveCRV_deposit",
+     "vault",
+     "c5bddf9843308380375a611c18b50fb9341f502a",
+     "b6b55f25"
+     "0000000000000000000000000000000000000000000000976f6bf37c8c56c44d"},
+    {"yveCRV_deposit_all",
+     "vault",
+     "c5bddf9843308380375a611c18b50fb9341f502a",
+     "de5f6268"},
+    {"zap_in_usdc_sushi",
+     "zap",
+     "92be6adb6a12da0ca607f9d87db2f9978cd6ec3e",
+     "38b32e68"
+     "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+     "0000000000000000000000000000000000000000000000000000000ba43b7400"
+     "0000000000000000000000006d765cbe5bc922694afe112c140b8878b9fb0390"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000012030e3ab42d7722d24"
+     "0000000000000000000000006b3595068778dd592e39a122f4f5a5cf09c90fe2"
+     "000000000000000000000000def1c0ded9bec7f1a1670819833240f027b25eff"
+     "0000000000000000000000000000000000000000000000000000000000000160"
+     "000000000000000000000000feb4acf3df3cdea7399794d0869ef76a6efaff52"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000988"
+     "415565b0000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce"
+     "3606eb480000000000000000000000006b3595068778dd592e39a122f4f5a5cf"
+     "09c90fe20000000000000000000000000000000000000000000000000000000b"
+     "a43b7400000000000000000000000000000000000000000000000127e34a1360"
+     "09ce25b400000000000000000000000000000000000000000000000000000000"
+     "000000a000000000000000000000000000000000000000000000000000000000"
+     "0000000300000000000000000000000000000000000000000000000000000000"
+     "0000006000000000000000000000000000000000000000000000000000000000"
+     "000003c000000000000000000000000000000000000000000000000000000000"
+     "0000072000000000000000000000000000000000000000000000000000000000"
+     "0000001500000000000000000000000000000000000000000000000000000000"
+     "0000004000000000000000000000000000000000000000000000000000000000"
+     "0000030000000000000000000000000000000000000000000000000000000000"
+     "0000002000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce"
+     "3606eb48000000000000000000000000c02aaa39b223fe8d0a0e5c4f27ead908"
+     "3c756cc200000000000000000000000000000000000000000000000000000000"
+     "0000012000000000000000000000000000000000000000000000000000000000"
+     "000002c000000000000000000000000000000000000000000000000000000000"
+     "000002c000000000000000000000000000000000000000000000000000000000"
+     "000002a00000000000000000000000000000000000000000000000000000000b"
+     "a43b740000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000100000000000000000000000000000000000000000000000000000000"
+     "0000002000000000000000000000000000000012556e69737761705633000000"
+     "000000000000000000000000000000000000000000000000000000000000000b"
+     "a43b740000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000008000000000000000000000000000000000000000000000000000000000"
+     "000000a0000000000000000000000000e592427a0aece92de3edee1f18e0157c"
+     "0586156400000000000000000000000000000000000000000000000000000000"
+     "0000004000000000000000000000000000000000000000000000000000000000"
+     "0000002ba0b86991c6218b36c1d19d4a2e9eb0ce3606eb480001f4c02aaa39b2"
+     "23fe8d0a0e5c4f27ead9083c756cc20000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000100000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000001500000000000000000000000000000000000000000000000000000000"
+     "0000004000000000000000000000000000000000000000000000000000000000"
+     "0000030000000000000000000000000000000000000000000000000000000000"
+     "0000002000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000c02aaa39b223fe8d0a0e5c4f27ead908"
+     "3c756cc20000000000000000000000006b3595068778dd592e39a122f4f5a5cf"
+     "09c90fe200000000000000000000000000000000000000000000000000000000"
+     "0000012000000000000000000000000000000000000000000000000000000000"
+     "000002c000000000000000000000000000000000000000000000000000000000"
+     "000002c000000000000000000000000000000000000000000000000000000000"
+     "000002a0ffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+     "ffffffff00000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000100000000000000000000000000000000000000000000000000000000"
+     "0000002000000000000000000000000000000002536869626153776170000000"
+     "00000000ffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+     "ffffffff000000000000000000000000000000000000000000000127e34a1360"
+     "09ce25b400000000000000000000000000000000000000000000000000000000"
+     "0000008000000000000000000000000000000000000000000000000000000000"
+     "000000a000000000000000000000000003f7724180aa6b939894b5ca4314783b"
+     "0b36b32900000000000000000000000000000000000000000000000000000000"
+     "0000004000000000000000000000000000000000000000000000000000000000"
+     "00000002000000000000000000000000c02aaa39b223fe8d0a0e5c4f27ead908"
+     "3c756cc20000000000000000000000006b3595068778dd592e39a122f4f5a5cf"
+     "09c90fe200000000000000000000000000000000000000000000000000000000"
+     "0000000100000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000700000000000000000000000000000000000000000000000000000000"
+     "0000004000000000000000000000000000000000000000000000000000000000"
+     "0000010000000000000000000000000000000000000000000000000000000000"
+     "0000002000000000000000000000000000000000000000000000000000000000"
+     "0000004000000000000000000000000000000000000000000000000000000000"
+     "000000c000000000000000000000000000000000000000000000000000000000"
+     "00000003000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce"
+     "3606eb48000000000000000000000000c02aaa39b223fe8d0a0e5c4f27ead908"
+     "3c756cc2000000000000000000000000eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+     "eeeeeeee00000000000000000000000000000000000000000000000000000000"
+     "00000000869584cd000000000000000000000000f4e386b070a18419b5d3af56"
+     "699f8a438dd18e89000000000000000000000000000000000000000000000011"
+     "1eca289661977380000000000000000000000000000000000000000000000000"},
+    {"zap_in_eth_weth",
+     "zap",
+     "92be6adb6a12da0ca607f9d87db2f9978cd6ec3e",
+     "38b32e68"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000029a2241af62c0000"
+     "000000000000000000000000a258c4606ca8206d8aa700ce2143d7db854d168c"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000028f5789c16a1e619"
+     "000000000000000000000000c02aaa39b223fe8d0a0e5c4f27ead9083c756cc2"
+     "000000000000000000000000c02aaa39b223fe8d0a0e5c4f27ead9083c756cc2"
+     "0000000000000000000000000000000000000000000000000000000000000160"
+     "000000000000000000000000feb4acf3df3cdea7399794d0869ef76a6efaff52"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000048"
+     "d0e30db0869584cd000000000000000000000000f4e386b070a18419b5d3af56"
+     "699f8a438dd18e890000000000000000000000000000000000000000000000bc"
+     "3851b2fe61975950000000000000000000000000000000000000000000000000"},
+    {"zap_in_usdc_pickle",
+     "zap",
+     "c695f73c1862e050059367b2e64489e66c525983",
+     "28932094"
+     "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+     "000000000000000000000000000000000000000000000000000000109d8af02d"
+     "0000000000000000000000001bf62acb8603ef7f3a0dfaf79b25202fe1faee06"
+     "000000000000000000000000000000000000000000000d80f48a4300a0482b59"
+     "0000000000000000000000005a6a4d54456819380173272a5e8e9b9904bdf41b"
+     "0000000000000000000000005ce9b49b7a1be9f2c3dc2b2a5bacea56fa21fbee"
+     "0000000000000000000000000000000000000000000000000000000000000100"
+     "0000000000000000000000003ce37278de6388532c3949ce4e886f365b14fb56"
+     "0000000000000000000000000000000000000000000000000000000000000144"
+     "64c98c6c000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce"
+     "3606eb48000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce"
+     "3606eb480000000000000000000000005a6a4d54456819380173272a5e8e9b99"
+     "04bdf41b00000000000000000000000000000000000000000000000000000010"
+     "9d8af02d000000000000000000000000000000000000000000000e74221c1aa5"
+     "30bd84ad00000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000010000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"
+     "0000000100000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    // Zaps the Ethereum app has no info on: DAI is one of the registry's zapTokens, the vault (a
+    // placeholder) is missing from the registry but its token is in HOST_TOKENS.
+    {"zap_in_dai",
+     "zap",
+     "92be6adb6a12da0ca607f9d87db2f9978cd6ec3e",
+     "38b32e68"
+     "0000000000000000000000006b175474e89094c44da98b954eedeac495271d0f"
+     "00000000000000000000000000000000000000000000003635c9adc5dea00000"
+     "0000000000000000000000006d765cbe5bc922694afe112c140b8878b9fb0390"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {"zap_in_unknown_vault",
+     "zap",
+     "92be6adb6a12da0ca607f9d87db2f9978cd6ec3e",
+     "38b32e68"
+     "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+     "0000000000000000000000000000000000000000000000000000000ba43b7400"
+     "0000000000000000000000000000000000000000000000000000000000000002"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {"ib_mint",
+     "iron_bank",
+     "950027632fbd6adadfe82644bfb64647642b6c09",
+     "a0712d68"
+     "000000000000000000000000000000000000000000000000000003941e390d81"},
+    {"ib_redeem",
+     "iron_bank",
+     "41c84c0e2ee0b740cf0d31f63f3b6f627dc6b393",
+     "db006a75"
+     "0000000000000000000000000000000000000000000000000000000b6c399b59"},
+    {"ib_redeem_underlying",
+     "iron_bank",
+     "41c84c0e2ee0b740cf0d31f63f3b6f627dc6b393",
+     "852a12e3"
+     "0000000000000000000000000000000000000000000000000de8dda323830c13"},
+    {"ib_borrow",
+     "iron_bank",
+     "950027632fbd6adadfe82644bfb64647642b6c09",
+     "c5ebeaec"
+     "000000000000000000000000000000000000000000000000000003f6e2afa500"},
+    {"ib_repay_borrow",
+     "iron_bank",
+     "950027632fbd6adadfe82644bfb64647642b6c09",
+     "0e752702"
+     "000000000000000000000000000000000000000000000000000003f6e2afa500"},
+    {"yveCRV_claim",
+     "lab",
+     "c5bddf9843308380375a611c18b50fb9341f502a",
+     "4e71d92d"},
+    {"pickle_exit",
+     "lab",
+     "da481b277dce305b97f4091bd66595d57cf31634",
+     "e9fad8ee"},
+    {"pickle_getRewards",
+     "lab",
+     "da481b277dce305b97f4091bd66595d57cf31634",
+     "3d18b912"},
+};
+
+const size_t HOST_VECTORS_COUNT = sizeof(HOST_VECTORS) / sizeof(HOST_VECTORS[0]);
+
+const tokenDefinition_t HOST_TOKENS[] = {
+    {{0xa0, 0xb8, 0x69, 0x91, 0xc6, 0x21, 0x8b, 0x36, 0xc1, 0xd1,
+      0x9d, 0x4a, 0x2e, 0x9e, 0xb0, 0xce, 0x36, 0x06, 0xeb, 0x48},
+     "USDC",
+     6},
+    {{0xc0, 0x2a, 0xaa, 0x39, 0xb2, 0x23, 0xfe, 0x8d, 0x0a, 0x0e,
+      0x5c, 0x4f, 0x27, 0xea, 0xd9, 0x08, 0x3c, 0x75, 0x6c, 0xc2},
+     "WETH",
+     18},
+    // Vault of "zap_in_unknown_vault".
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02},
+     "yvNEW",
+     18},
+};
+
+const size_t HOST_TOKENS_COUNT = sizeof(HOST_TOKENS) / sizeof(HOST_TOKENS[0]);
+
+bool host_vector_load(const host_vector_t *vector,
+                      host_tx_t *tx,
+                      uint8_t *calldata,
+                      size_t calldata_size,
+                      size_t *calldata_len) {
+    uint8_t destination[ADDRESS_LENGTH];
+    int len = host_parse_hex(vector->calldata, calldata, calldata_size);
+
+    if (len < 0 ||
+        host_parse_hex(vector->destination, destination, sizeof(destination)) != ADDRESS_LENGTH) {
+        return false;
+    }
+    *calldata_len = (size_t) len;
+    host_tx_init(tx, destination, HOST_TOKENS, HOST_TOKENS_COUNT);
+    return true;
+}
@@ -0,0 +1,27 @@
+// Transactions shared by the host tests and benchmarks: one per Zemu test in tests/src, named
+// after its file, with the same calldata and destination. The "erc4626" (yvUSDC-1) and "router"
+// ones have no Zemu test yet.
+#pragma once
+
+#include "host_plugin.h"
+
+typedef struct host_vector_t {
+    const char *name;
+    const char *family;       // "vault", "erc4626", "router", "zap", "iron_bank" or "lab"
+    const char *destination;  // hex, without "0x"
+    const char *calldata;     // hex, without "0x"
+} host_vector_t;
+
+extern const host_vector_t HOST_VECTORS[];
+extern const size_t HOST_VECTORS_COUNT;
+
+// Tokens known to the Ethereum app, for the zaps' PROVIDE_INFO.
+extern const tokenDefinition_t HOST_TOKENS[];
+extern const size_t HOST_TOKENS_COUNT;
+
+// Parses `vector` into `calldata` and resets `tx` for it. Returns false if it is malformed.
+bool host_vector_load(const host_vector_t *vector,
+                      host_tx_t *tx,
+                      uint8_t *calldata,
+                      size_t calldata_size,
+                      size_t *calldata_len);
@@ -0,0 +1,410 @@
+#!/usr/bin/env python3
+"""Count the ARM instructions executed by each plugin entry point under Speculos.
+
+Speculos runs the Ethereum app and the plugin in qemu-arm. With QEMU_LOG=in_asm,exec,nochain,
+qemu logs every translation block once (in_asm, which gives its instruction count) and every
+execution of a block (exec, nochain so that chained blocks are logged too). Attributing each
+executed block to the plugin symbol that contains it gives deterministic, device-independent
+instruction counts, which is what the device itself cannot give us.
+
+Counts are inclusive: everything executed from the entry of a `handle_*` function until control
+goes back to `dispatch_plugin_calls` (SDK helpers such as amountToString included) is charged to
+that handler. Code run by the OS (syscalls, emulated natively by Speculos) is not counted.
+
+  speculos_profile.py run [-m nanos|nanox] [-f name|family]...
+      Starts Speculos once per transaction of tests/host/vectors.c, signs it, scrolls through
+      all the screens and approves it, then prints the counts per transaction and handler.
+      Needs `speculos` in PATH (pip install speculos) and the ELFs in tests/elfs.
+
+  speculos_profile.py analyze --elf tests/elfs/plugin_nanos.elf qemu.log
+      Analyzes an existing log, e.g. from a Speculos started by hand with QEMU_LOG set.
+
+The plugin is not loaded at its link address; the load bias is detected by matching executed
+block addresses against the plugin's function addresses, or can be given with --bias.
+"""
+
+import argparse
+import array
+import collections
+import json
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import urllib.request
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+VECTORS = os.path.join(ROOT, "tests", "host", "vectors.c")
+ELFS = os.path.join(ROOT, "tests", "elfs")
+
+PLUGIN_NAME = "Yearn"
+DISPATCH = "dispatch_plugin_calls"
+ENTRY_PREFIX = "handle_"
+# Speculos' default seed, first address: SPECULOS_ADDRESS in tests/src/test.fixture.js.
+BIP32_PATH = [0x8000002C, 0x8000003C, 0x80000000, 0, 0]
+
+TRACE_RE = re.compile(r"^Trace [^\[]*\[([0-9a-fA-F]+)/([0-9a-fA-F]+)/")
+INSN_RE = re.compile(r"^0x([0-9a-fA-F]+):")
+
+
+# ELF symbols ####################################################################################
+
+class Symbols:
+    """Function symbols of a 32-bit little-endian ARM ELF, sorted by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("%s: not a 32-bit little-endian ELF" % path)
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        sections = [struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize)
+                    for i in range(shnum)]
+
+        functions = {}
+        for section in sections:
+            if section[1] != 2:  # SHT_SYMTAB
+                continue
+            strtab = sections[section[6]]
+            for offset in range(section[4], section[4] + section[5], 16):
+                name, value, size, info, _, _ = struct.unpack_from("<IIIBBH", data, offset)
+                if info & 0xF != 2:  # STT_FUNC
+                    continue
+                start = strtab[4] + name
+                name = data[start:data.index(b"\0", start)].decode()
+                functions[value & ~1] = (name, size)  # Clear the Thumb bit.
+
+        self.starts = sorted(functions)
+        self.names = [functions[a][0] for a in self.starts]
+        self.ends = [a + max(functions[a][1], 2) for a in self.starts]
+        self.by_name = {name: start for start, name in zip(self.starts, self.names)}
+
+    def lookup(self, address):
+        """Returns the name of the function containing `address`, or None."""
+        low, high = 0, len(self.starts)
+        while low < high:
+            mid = (low + high) // 2
+            if self.starts[mid] <= address:
+                low = mid + 1
+            else:
+                high = mid
+        if low and address < self.ends[low - 1]:
+            return self.names[low - 1]
+        return None
+
+
+# QEMU log #######################################################################################
+
+def parse_log(lines):
+    """Yields ("block", pc, instruction_count) for in_asm entries and ("exec", pc) for each
+    executed block."""
+    block_pc, block_count = None, 0
+    for line in lines:
+        match = INSN_RE.match(line)
+        if match:
+            if block_pc is None:
+                block_pc = int(match.group(1), 16)
+            block_count += 1
+            continue
+        if block_pc is not None:
+            yield ("block", block_pc, block_count)
+            block_pc, block_count = None, 0
+        match = TRACE_RE.match(line)
+        if match:
+            yield ("exec", int(match.group(2), 16))
+    if block_pc is not None:
+        yield ("block", block_pc, block_count)
+
+
+def detect_bias(block_sizes, symbols):
+    """Finds the offset between run-time and link-time addresses of the plugin: the one that
+    maps the most translated blocks onto the plugin entry points."""
+    anchors = [start for start, name in zip(symbols.starts, symbols.names)
+               if name.startswith(ENTRY_PREFIX) or name in (DISPATCH, "main")]
+    votes = collections.Counter()
+    for pc in block_sizes:
+        for start in anchors:
+            votes[pc - start] += 1
+    if DISPATCH in symbols.by_name:
+        # The right bias maps at least one translated block onto dispatch_plugin_calls.
+        for bias, _ in votes.most_common(16):
+            if symbols.by_name[DISPATCH] + bias in block_sizes:
+                return bias
+    return votes.most_common(1)[0][0] if votes else 0
+
+
+class Profile:
+    """Instruction counts of one run, per entry point and per function."""
+
+    def __init__(self, symbols, bias):
+        self.symbols = symbols
+        self.bias = bias
+        self.entries = collections.OrderedDict()  # name -> [calls, instructions]
+        self.functions = collections.Counter()  # (entry, function) -> instructions
+        self.untraced = 0  # Executed blocks never seen in in_asm (log started late).
+        self.entry = None
+
+    def execute(self, pc, count):
+        pc -= self.bias
+        function = self.symbols.lookup(pc)
+        if function is None:
+            # Outside of the plugin: back in the Ethereum app or the OS.
+            self.entry = None
+            return
+        if count is None:
+            self.untraced += 1
+            return
+        if (self.entry is None and function.startswith(ENTRY_PREFIX) and
+                pc == self.symbols.by_name[function]):
+            # Called by dispatch_plugin_calls. Nested handle_* helpers stay in their caller.
+            self.entry = function
+            self.entries.setdefault(function, [0, 0])[0] += 1
+        elif function in (DISPATCH, "main"):
+            self.entry = None
+        if self.entry is not None:
+            self.entries[self.entry][1] += count
+            self.functions[(self.entry, function)] += count
+
+    def as_dict(self):
+        return {
+            "entries": {name: {"calls": c, "instructions": i}
+                        for name, (c, i) in self.entries.items()},
+            "functions": {"%s/%s" % key: value for key, value in self.functions.items()},
+        }
+
+
+def analyze(lines, symbols, bias=None):
+    """Returns the Profile of a QEMU log. Without `bias`, executed addresses are kept (4 bytes
+    each) until the end of the log, where the bias is detected."""
+    sizes = {}
+    if bias is not None:
+        profile = Profile(symbols, bias)
+        for event in parse_log(lines):
+            if event[0] == "block":
+                sizes[event[1]] = event[2]
+            else:
+                profile.execute(event[1], sizes.get(event[1]))
+        return profile
+
+    executed = array.array("I")
+    for event in parse_log(lines):
+        if event[0] == "block":
+            sizes[event[1]] = event[2]
+        else:
+            executed.append(event[1])
+    profile = Profile(symbols, detect_bias(sizes, symbols))
+    for pc in executed:
+        profile.execute(pc, sizes.get(pc))
+    return profile
+
+
+def print_profile(name, profile, top):
+    print("== %s (load bias %#x)" % (name, profile.bias & 0xFFFFFFFF))
+    print("  %-28s %6s %12s %12s" % ("entry point", "calls", "instructions", "instr/call"))
+    for entry, (calls, instructions) in profile.entries.items():
+        print("  %-28s %6d %12d %12.1f" % (entry, calls, instructions, instructions / calls))
+        functions = sorted(((count, function) for (e, function), count
+                            in profile.functions.items() if e == entry), reverse=True)
+        for count, function in functions[:top]:
+            if function != entry:
+                print("      %-32s %12d" % (function, count))
+    if profile.untraced:
+        print("  (%d executed blocks had no in_asm entry and were not counted)" % profile.untraced)
+
+
+# Speculos driver ################################################################################
+
+def load_vectors():
+    """Parses the transactions of tests/host/vectors.c."""
+    with open(VECTORS) as f:
+        source = f.read()
+    pattern = re.compile(r'\{"(\w+)",\s*"(\w+)",\s*"([0-9a-f]{40})",\s*((?:"[0-9a-f]*"\s*)+)\}')
+    vectors = []
+    for match in pattern.finditer(source):
+        calldata = "".join(re.findall(r'"([0-9a-f]*)"', match.group(4)))
+        vectors.append({"name": match.group(1), "family": match.group(2),
+                        "destination": match.group(3), "calldata": calldata})
+    return vectors
+
+
+def rlp(item):
+    if isinstance(item, list):
+        payload = b"".join(rlp(i) for i in item)
+        prefix = 0xC0
+    else:
+        payload = item
+        if len(payload) == 1 and payload[0] < 0x80:
+            return payload
+        prefix = 0x80
+    if len(payload) < 56:
+        return bytes([prefix + len(payload)]) + payload
+    length = len(payload).to_bytes((len(payload).bit_length() + 7) // 8, "big")
+    return bytes([prefix + 55 + len(length)]) + length + payload
+
+
+def int_bytes(value):
+    return value.to_bytes((value.bit_length() + 7) // 8, "big")
+
+
+def unsigned_tx(vector):
+    """Legacy (EIP-155, chain 1) transaction calling `vector`, as signed by the Zemu tests."""
+    fields = [int_bytes(0), int_bytes(10**9), int_bytes(300000),
+              bytes.fromhex(vector["destination"]), int_bytes(0),
+              bytes.fromhex(vector["calldata"]), int_bytes(1), b"", b""]
+    return rlp(fields)
+
+
+class Speculos:
+    def __init__(self, args, log_path):
+        self.url = "http://127.0.0.1:%d" % args.api_port
+        plugin = os.path.join(ELFS, "plugin_%s.elf" % args.model)
+        ethereum = os.path.join(ELFS, "ethereum_%s.elf" % args.model)
+        env = dict(os.environ, QEMU_LOG="in_asm,exec,nochain", QEMU_LOG_FILENAME=log_path)
+        command = [args.speculos, "--model", args.model, "--display", "headless",
+                   "--api-port", str(args.api_port), "--apdu-port", "0",
+                   "-l", "%s:%s" % (PLUGIN_NAME, plugin), ethereum]
+        self.process = subprocess.Popen(command, env=env, stdout=subprocess.DEVNULL,
+                                        stderr=subprocess.DEVNULL)
+
+    def request(self, method, path, body=None, timeout=60):
+        data = json.dumps(body).encode() if body is not None else None
+        request = urllib.request.Request(self.url + path, data=data, method=method,
+                                         headers={"Content-Type": "application/json"})
+        with urllib.request.urlopen(request, timeout=timeout) as response:
+            return json.loads(response.read() or b"{}")
+
+    def wait_ready(self, timeout=60):
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            try:
+                self.request("GET", "/events")
+                return
+            except OSError:
+                time.sleep(0.5)
+        raise RuntimeError("Speculos did not start")
+
+    def apdu(self, data):
+        response = bytes.fromhex(self.request("POST", "/apdu", {"data": data.hex()}, 600)["data"])
+        if response[-2:] != b"\x90\x00":
+            raise RuntimeError("APDU %s... failed: %s" % (data[:5].hex(), response[-2:].hex()))
+        return response[:-2]
+
+    def press(self, button):
+        self.request("POST", "/button/%s" % button, {"action": "press-and-release"})
+
+    def screen_text(self):
+        events = self.request("GET", "/events?currentscreenonly=true").get("events", [])
+        return " ".join(e.get("text", "") for e in events)
+
+    def close(self):
+        self.process.terminate()
+        try:
+            self.process.wait(10)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+
+
+def sign(speculos, vector):
+    """Loads the plugin for the selector and signs the transaction, approving every screen."""
+    selector = bytes.fromhex(vector["calldata"][:8])
+    name = PLUGIN_NAME.encode()
+    # SET_EXTERNAL_PLUGIN; the test ELFs are built with BYPASS_SIGNATURES, any signature works.
+    payload = bytes([len(name)]) + name + bytes.fromhex(vector["destination"]) + selector
+    speculos.apdu(bytes([0xE0, 0x12, 0x00, 0x00, len(payload) + 1]) + payload + b"\x00")
+
+    data = bytes([len(BIP32_PATH)]) + b"".join(struct.pack(">I", i) for i in BIP32_PATH)
+    data += unsigned_tx(vector)
+    chunks = [data[i:i + 255] for i in range(0, len(data), 255)]
+    result = {}
+
+    def send():
+        try:
+            for i, chunk in enumerate(chunks):
+                p1 = 0x00 if i == 0 else 0x80
+                speculos.apdu(bytes([0xE0, 0x04, p1, 0x00, len(chunk)]) + chunk)
+        except Exception as e:  # Reported by the main thread.
+            result["error"] = e
+        result["done"] = True
+
+    thread = threading.Thread(target=send)
+    thread.start()
+    for _ in range(64):
+        time.sleep(0.3)
+        if result.get("done"):
+            break
+        if re.search(r"\b(Accept|Approve)\b", speculos.screen_text()):
+            speculos.press("both")
+            break
+        speculos.press("right")
+    thread.join(600)
+    if "error" in result:
+        raise result["error"]
+
+
+def run(args):
+    vectors = [v for v in load_vectors()
+               if not args.filter or v["name"] in args.filter or v["family"] in args.filter]
+    symbols = Symbols(os.path.join(ELFS, "plugin_%s.elf" % args.model))
+    results = {}
+    for vector in vectors:
+        with tempfile.TemporaryDirectory() as tmp:
+            fifo = os.path.join(tmp, "qemu.log")
+            os.mkfifo(fifo)
+            speculos = Speculos(args, fifo)
+            output = {}
+            # The log goes through a FIFO: a full trace of the Ethereum app runs into gigabytes.
+            reader = threading.Thread(target=lambda: output.update(
+                result=analyze(open(fifo, errors="replace"), symbols, args.bias)))
+            reader.start()
+            try:
+                speculos.wait_ready()
+                sign(speculos, vector)
+            finally:
+                speculos.close()
+                reader.join()
+        profile = output["result"]
+        results[vector["name"]] = dict(profile.as_dict(), family=vector["family"])
+        print_profile("%s (%s)" % (vector["name"], vector["family"]), profile, args.top)
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(results, f, indent=2)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--bias", type=lambda x: int(x, 0), help="load bias of the plugin")
+    parser.add_argument("--top", type=int, default=5,
+                        help="functions listed under each entry point (default 5)")
+    parser.add_argument("--json", help="also write the results to this file")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = commands.add_parser("run", help="profile the transactions of vectors.c")
+    run_parser.add_argument("-m", "--model", choices=("nanos", "nanox"), default="nanos")
+    run_parser.add_argument("-f", "--filter", action="append",
+                            help="transaction name or family, may be repeated")
+    run_parser.add_argument("--speculos", default="speculos", help="Speculos command")
+    run_parser.add_argument("--api-port", type=int, default=5000)
+
+    analyze_parser = commands.add_parser("analyze", help="analyze an existing QEMU log")
+    analyze_parser.add_argument("--elf", required=True, help="plugin ELF")
+    analyze_parser.add_argument("log", help="QEMU log (in_asm,exec,nochain)")
+
+    args = parser.parse_args()
+    if args.command == "run":
+        run(args)
+    else:
+        with open(args.log, errors="replace") as f:
+            profile = analyze(f, Symbols(args.elf), args.bias)
+        print_profile(os.path.basename(args.log), profile, args.top)
+        if args.json:
+            with open(args.json, "w") as f:
+                json.dump(profile.as_dict(), f, indent=2)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
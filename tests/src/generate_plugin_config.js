@@ -82,4 +82,5 @@ function generate_plugin_config() {
 
 module.exports = {
 	generate_plugin_config,
+	serialize_data,
 };
@@ -20,7 +20,7 @@ test('[Nano S] IB Repay Borrow', zemu("nanos", async (sim, eth) => {
   const tx = eth.signTransaction("44'/60'/0'/0", serializedTx);
 
   await waitForAppScreen(sim);
-  await sim.navigateAndCompareSnapshots('.', 'nanos_ib_borrow', [BASE_SCREENS_S, 0]);
+  await sim.navigateAndCompareSnapshots('.', 'nanos_ib_repay_borrow', [BASE_SCREENS_S, 0]);
   await tx;
 }));
 
@@ -35,6 +35,6 @@ test('[Nano X] IB Repay Borrow', zemu("nanox", async (sim, eth) => {
   const tx = eth.signTransaction("44'/60'/0'/0", serializedTx);
 
   await waitForAppScreen(sim);
-  await sim.navigateAndCompareSnapshots('.', 'nanox_ib_borrow', [BASE_SCREENS_X, 0]);
+  await sim.navigateAndCompareSnapshots('.', 'nanox_ib_repay_borrow', [BASE_SCREENS_X, 0]);
   await tx;
 }));
\ No newline at end of file
@@ -0,0 +1,120 @@
+import "core-js/stable";
+import "regenerator-runtime/runtime";
+import { execFileSync } from 'child_process';
+import { ethers } from "ethers";
+import { generate_plugin_config, serialize_data } from './generate_plugin_config';
+import { waitForAppScreen, readScreens, zemu, zemu_plugin, genericTx } from './test.fixture';
+
+const CLA = 0xe0;
+const INS_LOAD_REGISTRY = 0x80;
+const INS_COMMIT_REGISTRY = 0x81;
+const INS_GET_REGISTRY = 0x82;
+const P1_FIRST_CHUNK = 0x00;
+const P1_NEXT_CHUNK = 0x80;
+const SW_OK = 0x9000;
+const SW_SECURITY_STATUS = 0x6982;
+const SW_CONDITIONS_NOT_SATISFIED = 0x6985;
+const CHUNK_SIZE = 100;
+
+// The ELFs of tests/elfs are built without the registry: these tests need those of
+// build_local_test_elfs.sh (job_build_registry_elfs in CI), and a Speculos that keeps the NVM of
+// the plugin between its runs.
+const registryTest = process.env.NVM_REGISTRY ? test : test.skip;
+const SAVE_NVRAM = '--save-nvram';
+const LOAD_NVRAM = '--load-nvram';
+
+// yvTEST of registry/update.json, and a listed vault to take the plugin config of its deposit.
+const TEST_VAULT = '0x3333333333333333333333333333333333333333';
+const LISTED_VAULT = '0xda481b277dce305b97f4091bd66595d57cf31634';
+const DEPOSIT_SELECTOR = '0xb6b55f25';
+const BASE_SCREENS = (1 + 1 + 1 + 1 + 1) //YEARN + AMOUNT + GAS_FEES + VAULT + APPROVE
+
+// registry/update.json, signed with the key the test ELFs are built with.
+function signedUpdate() {
+  const output = execFileSync('python3', [
+    '../tools/sign_registry.py', 'registry/update.json', 'registry/test_key.hex',
+  ]);
+  const [update, signature] = output.toString().trim().split('\n');
+  return [Buffer.from(update, 'hex'), Buffer.from(signature, 'hex')];
+}
+
+async function load(transport, update, statusList = [SW_OK]) {
+  let response;
+  for (let i = 0; i < update.length; i += CHUNK_SIZE) {
+    const p1 = i === 0 ? P1_FIRST_CHUNK : P1_NEXT_CHUNK;
+    response = await transport.send(CLA, INS_LOAD_REGISTRY, p1, 0x00,
+                                    update.slice(i, i + CHUNK_SIZE), statusList);
+  }
+  return response;
+}
+
+function status(response) {
+  return response.readUInt16BE(response.length - 2);
+}
+
+function registryUpdate(device) {
+  return zemu_plugin(device, async (sim, transport) => {
+    const [update, signature] = signedUpdate();
+
+    // Changed after signing: loaded, but not committed.
+    const tampered = Buffer.from(update);
+    tampered[tampered.length - 1] ^= 1;
+    await load(transport, tampered);
+    let response = await transport.send(CLA, INS_COMMIT_REGISTRY, 0x00, 0x00, signature,
+                                        [SW_OK, SW_SECURITY_STATUS]);
+    expect(status(response)).toEqual(SW_SECURITY_STATUS);
+
+    await load(transport, update);
+    await transport.send(CLA, INS_COMMIT_REGISTRY, 0x00, 0x00, signature);
+
+    // Valid, sequence 1, chain 1, 2 vaults and 1 Iron Bank market.
+    response = await transport.send(CLA, INS_GET_REGISTRY, 0x00, 0x00);
+    expect(response.toString('hex')).toEqual('01' + '00000001' + '0000000000000001' + '0201' + '9000');
+    response = await transport.send(CLA, INS_GET_REGISTRY, 0x00, 0x00,
+                                    Buffer.from('33'.repeat(20), 'hex'));
+    expect(response).toEqual(Buffer.concat([
+      Buffer.from([6, 4]), Buffer.from('TEST'), Buffer.from([6]), Buffer.from('yvTEST'),
+      Buffer.from([0x90, 0x00]),
+    ]));
+
+    // Replayed: refused before the registry is touched.
+    response = await load(transport, update, [SW_OK, SW_CONDITIONS_NOT_SATISFIED]);
+    expect(status(response)).toEqual(SW_CONDITIONS_NOT_SATISFIED);
+    response = await transport.send(CLA, INS_GET_REGISTRY, 0x00, 0x00);
+    expect(response[0]).toEqual(1);
+  }, SAVE_NVRAM);
+}
+
+// Deposits 1 TEST in yvTEST, with the registry loaded by `registryUpdate`: the vault is only known
+// from it.
+function depositToLoadedVault(device) {
+  return zemu(device, async (sim, eth) => {
+    const config = generate_plugin_config();
+    const deposit = {
+      ...config[LISTED_VAULT][DEPOSIT_SELECTOR],
+      serialized_data: serialize_data("Yearn", TEST_VAULT, DEPOSIT_SELECTOR),
+    };
+    config[TEST_VAULT] = { [DEPOSIT_SELECTOR]: deposit, abi: config[LISTED_VAULT].abi };
+    eth.setPluginsLoadConfig({ baseURL: null, extraPlugins: config });
+
+    const contract = new ethers.Contract(TEST_VAULT, ['function deposit(uint256)']);
+    const {data} = await contract.populateTransaction.deposit('1000000');
+    const unsignedTx = { ...genericTx, to: TEST_VAULT, data };
+
+    const serializedTx = ethers.utils.serializeTransaction(unsignedTx).slice(2);
+    const tx = eth.signTransaction("44'/60'/0'/0", serializedTx);
+
+    await waitForAppScreen(sim);
+    const screens = await readScreens(sim, [BASE_SCREENS, 0]);
+    const text = screens.map((screen) => screen.join(' ')).join('\n');
+    expect(text).toContain('1 TEST');
+    expect(text).toContain('yvTEST');
+    await tx;
+  }, LOAD_NVRAM);
+}
+
+registryTest('[Nano S] Registry update', registryUpdate("nanos"));
+registryTest('[Nano S] Deposit to a vault of the registry', depositToLoadedVault("nanos"));
+
+registryTest('[Nano X] Registry update', registryUpdate("nanox"));
+registryTest('[Nano X] Deposit to a vault of the registry', depositToLoadedVault("nanox"));
@@ -2,6 +2,9 @@ import Zemu from '@zondax/zemu';
 import Eth from '@ledgerhq/hw-app-eth';
 import { generate_plugin_config } from './generate_plugin_config';
 import { parseEther, parseUnits, RLP} from "ethers/lib/utils";
+import http from 'http';
+
+const Resolve = require('path').resolve;
 
 const transactionUploadDelay = 60000;
 
@@ -9,6 +12,71 @@ async function waitForAppScreen(sim) {
     await sim.waitUntilScreenIsNot(sim.getMainMenuSnapshot(), transactionUploadDelay);
 }
 
+// Reads the text Speculos draws on the screens, for the tests that check what they display.
+const SCREEN_CHANGE_TIMEOUT = 5000;
+const SCREEN_POLL_INTERVAL = 50;
+
+function speculosRequest(sim, method, path, body) {
+    const data = body === undefined ? undefined : JSON.stringify(body);
+    const options = {
+        host: sim.host,
+        port: sim.speculosApiPort,
+        path,
+        method,
+        headers: { 'Content-Type': 'application/json' },
+    };
+    return new Promise((resolve, reject) => {
+        const request = http.request(options, (response) => {
+            let payload = '';
+            response.on('data', (chunk) => { payload += chunk; });
+            response.on('end', () => resolve(payload ? JSON.parse(payload) : {}));
+        });
+        request.on('error', reject);
+        request.end(data);
+    });
+}
+
+async function readScreen(sim) {
+    const { events = [] } = await speculosRequest(sim, 'GET', '/events?currentscreenonly=true');
+    return events.map((event) => event.text);
+}
+
+// Waits until the screen differs from `previous` and has been drawn completely (two identical
+// reads in a row). Gives up after SCREEN_CHANGE_TIMEOUT, for consecutive screens with equal text.
+async function waitForNextScreen(sim, previous) {
+    const deadline = Date.now() + SCREEN_CHANGE_TIMEOUT;
+    let last = JSON.stringify(await readScreen(sim));
+    for (;;) {
+        await Zemu.sleep(SCREEN_POLL_INTERVAL);
+        const current = await readScreen(sim);
+        const text = JSON.stringify(current);
+        if ((text !== JSON.stringify(previous) && text === last) || Date.now() > deadline) {
+            return current;
+        }
+        last = text;
+    }
+}
+
+async function press(sim, button, screens) {
+    await speculosRequest(sim, 'POST', `/button/${button}`, { action: 'press-and-release' });
+    screens.push(await waitForNextScreen(sim, screens[screens.length - 1]));
+}
+
+// Goes through the screens as Zemu's navigateAndCompareSnapshots does (`clickSchedule`: n > 0 for
+// n right presses, 0 for both buttons) and returns the text of each one.
+async function readScreens(sim, clickSchedule) {
+    const screens = [await readScreen(sim)];
+    for (const clicks of clickSchedule) {
+        if (clicks === 0) {
+            await press(sim, 'both', screens);
+        }
+        for (let i = 0; i < clicks; i++) {
+            await press(sim, 'right', screens);
+        }
+    }
+    return screens;
+}
+
 const sim_options_generic = {
     logging: true,
     X11: true,
@@ -16,8 +84,6 @@ const sim_options_generic = {
     custom: '',
 };
 
-const Resolve = require('path').resolve;
-
 const NANOS_ETH_PATH = Resolve('elfs/ethereum_nanos.elf');
 const NANOX_ETH_PATH = Resolve('elfs/ethereum_nanox.elf');
 
@@ -74,7 +140,8 @@ function txFromEtherscan(rawTx) {
     return txType + encoded;
 }
 
-function zemu(device, func) {
+// `custom` is passed to Speculos.
+function zemu(device, func, custom = '') {
     return async () => {
         jest.setTimeout(TIMEOUT);
         let eth_path;
@@ -94,7 +161,7 @@ function zemu(device, func) {
         const sim = new Zemu(eth_path, plugin);
 
         try {
-            await sim.start(sim_options);
+            await sim.start({ ...sim_options, custom });
             const transport = await sim.getTransport();
             const eth = new Eth(transport);
             eth.setPluginsLoadConfig({
@@ -108,9 +175,27 @@ function zemu(device, func) {
     };
 }
 
+// Starts the plugin alone, as from the dashboard, to send it registry APDUs. The ELFs must be built
+// with NVM_REGISTRY=1 REGISTRY_TEST_KEY=1, see build_local_test_elfs.sh.
+function zemu_plugin(device, func, custom = '') {
+    return async () => {
+        jest.setTimeout(TIMEOUT);
+        const sim = new Zemu(device === "nanos" ? NANOS_PLUGIN_PATH : NANOX_PLUGIN_PATH);
+
+        try {
+            await sim.start({ ...sim_options_generic, model: device, custom });
+            await func(sim, await sim.getTransport());
+        } finally {
+            await sim.close();
+        }
+    };
+}
+
 module.exports = {
     zemu,
+    zemu_plugin,
     waitForAppScreen,
+    readScreens,
     genericTx,
     SPECULOS_ADDRESS,
     RANDOM_ADDRESS,
@@ -0,0 +1,739 @@
+#!/usr/bin/env python3
+"""Generate the plugin tables and the test configuration from registry/yearn.json.
+
+registry/yearn.json is the only place where selectors, vaults and Iron Bank
+markets are listed. This script writes:
+
+  src/yearn_registry.h   NUM_SELECTORS, NUM_CHAINS, MAX_PARAMS, MAX_SCREENS, NUM_DESTINATIONS,
+                         `selector_t`, `vault_prefix_t`
+  src/yearn_registry.c   YEARN_SELECTORS, PARAMETER_SCHEMAS, FLOWS, CHAINS, the vault and zap
+                         token tables of every chain, DESTINATION_FINGERPRINTS and the
+                         ticker pool
+  src/selector_hash.h    perfect hash over YEARN_SELECTORS, see `handle_init_contract`
+  tests/yearn/b2c.json   contracts and selectors handled by the plugin, each of which must
+                         have its ABI in tests/yearn/abis
+
+The "params" of a selector list its calldata words in order; they become the
+PARAMETER_SCHEMAS entry that `handle_provide_parameter` follows, see PARAMS.
+Its "flow" names an entry of "flows": the name and version shown first, and the
+screens that follow (see SCREENS), which become its FLOWS entry.
+Every contract belongs to one of "chains" ("chain", the first one by default);
+each chain has its own YEARN_VAULTS and IRON_BANK tables, e.g.
+YEARN_VAULTS_ETHEREUM, listed in CHAINS so that a lookup only searches the
+chain of the transaction, with the "nativeTicker" of its coin (sent to zaps as
+the null address). tests/yearn/b2c.json covers the first chain.
+Vault tables are sorted by address, as required by `find_vault_index`. Tickers
+are not stored in the table entries: they live once each in TICKER_POOL, as
+length-prefixed strings referenced by offset. A vault name is a prefix from
+"vaultPrefixes" (e.g. "yvCurve-") followed by a pooled string, which usually
+is the want ticker itself ("yvCurve-" + "stETH"). Every entry also carries the
+EIP-55 case mask of its address, so that the device displays known vaults
+without hashing them. The registry is validated first (duplicate addresses or
+selectors, ticker lengths, unknown selectors...) and nothing is written if it
+is invalid.
+
+"zapTokens" lists the tokens commonly sent to zaps (ticker and decimals) per
+chain, sorted by address in ZAP_TOKENS_<CHAIN>: `handle_provide_token` falls
+back to them when the Ethereum app has no info on the token sent.
+
+A contract lists its selectors, or the name of a "selectorSets" entry such as
+"erc4626" (deposit, mint, withdraw and redeem of ERC-4626 vaults, i.e. Yearn
+V3), which is expanded in tests/yearn/b2c.json.
+
+The address of every contract, vaults, markets, zaps, gauges and routers of all
+chains, is also fingerprinted (its first 4 bytes) in DESTINATION_FINGERPRINTS:
+`handle_init_contract` refuses other destinations, whatever the selector.
+
+Usage:
+  gen_registry.py           regenerate the files
+  gen_registry.py --check   exit with an error if a generated file is out of date
+"""
+
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+REGISTRY = "registry/yearn.json"
+# ABI of each contract of tests/yearn/b2c.json, as tests/src/generate_plugin_config.js loads it.
+ABIS = "tests/yearn/abis"
+
+ADDRESS_LENGTH = 20
+SELECTOR_SIZE = 4
+MAX_VAULT_TICKER_LEN = 18  # Must match yearn_plugin.h, includes the '\0'.
+MAX_TICKER_LEN = 12  # Of the Ethereum app, includes the '\0'.
+VAULT_NOT_FOUND = 0xFF
+SELECTOR_NOT_FOUND = 0xFF
+TABLES = ("YEARN_VAULTS", "IRON_BANK")
+ZAP_TOKENS = "ZAP_TOKENS"
+CHAIN_NOT_FOUND = 0xFF
+# Chains whose addresses are checksummed with EIP-1191 (RSK): the generated EIP-55 masks would be
+# wrong there.
+EIP1191_CHAINS = (30, 31)
+
+# Calldata word kinds of the registry "params": `param_kind_t` and destination field in context_t.
+PARAMS = {
+    "amount": ("PARAM_UINT256", "amount"),
+    "recipient": ("PARAM_ADDRESS", "extra_address"),
+    "owner": ("PARAM_ADDRESS", "owner"),
+    "token": ("PARAM_ADDRESS", "extra_address"),
+    "vault": ("PARAM_ADDRESS", "vault_address"),
+    "slippage": ("PARAM_UINT16", "slippage"),
+    "skip": ("PARAM_SKIP", None),  # One ignored word.
+    "rest": ("PARAM_REST", None),  # All remaining words are ignored, must come last.
+    "calls": ("PARAM_CALLS", None),  # multicall(bytes[]): the rest is a batch of calls.
+}
+# Params of the calls in a multicall ("batchable" flows), whose words are not 32-byte aligned.
+BATCH_PARAMS = ("amount", "vault", "recipient", "skip")
+MAX_BATCH_CALLS = 3  # Must match yearn_plugin.h.
+MAX_PARAMS_LIMIT = 7  # context_t.next_param has 3 bits and must be able to point past the end.
+
+# Screens of the registry "flows": `screen_t`, and the SCREEN_IF_* conditions written
+# "<screen> if <condition>".
+SCREENS = {
+    "amount_all": "SCREEN_AMOUNT_ALL",
+    "amount_want": "SCREEN_AMOUNT_WANT",
+    "amount_vault": "SCREEN_AMOUNT_VAULT",
+    "amount_bank": "SCREEN_AMOUNT_BANK",
+    "vault_name": "SCREEN_VAULT_NAME",
+    "bank_name": "SCREEN_BANK_NAME",
+    "pickle_vault_name": "SCREEN_PICKLE_VAULT_NAME",
+    "vault_address": "SCREEN_VAULT_ADDRESS",
+    "recipient": "SCREEN_RECIPIENT",
+    "owner": "SCREEN_OWNER",
+    "slippage": "SCREEN_SLIPPAGE",
+    "batch_call": "SCREEN_BATCH_CALL",
+}
+SCREEN_CONDITIONS = {"not_sender": "SCREEN_IF_NOT_SENDER"}
+FLOW_FLAGS = {
+    "iron_bank": "FLOW_IRON_BANK",
+    "vault_from_calldata": "FLOW_VAULT_FROM_CALLDATA",
+    "token_lookup": "FLOW_TOKEN_LOOKUP",
+    "batch": "FLOW_BATCH",
+    "batchable": "FLOW_BATCHABLE",
+}
+MAX_SCREENS_LIMIT = 8  # context_t.screens is a uint8_t bitmask.
+
+HEADER_COMMENT = "// Generated by tools/gen_registry.py from %s, do not edit." % REGISTRY
+
+
+class RegistryError(Exception):
+    pass
+
+
+KECCAK_ROUND_CONSTANTS = [
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+    0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+    0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+]
+# Rotation of lane x + 5 * y.
+KECCAK_ROTATIONS = [0, 1, 62, 28, 27, 36, 44, 6, 55, 20, 3, 10, 43, 25, 39,
+                    41, 45, 15, 21, 8, 18, 2, 61, 56, 14]
+MASK64 = (1 << 64) - 1
+
+
+def rotl64(value, shift):
+    return ((value << shift) | (value >> (64 - shift))) & MASK64 if shift else value
+
+
+def keccak_f(lanes):
+    for constant in KECCAK_ROUND_CONSTANTS:
+        c = [lanes[x] ^ lanes[x + 5] ^ lanes[x + 10] ^ lanes[x + 15] ^ lanes[x + 20]
+             for x in range(5)]
+        d = [c[(x - 1) % 5] ^ rotl64(c[(x + 1) % 5], 1) for x in range(5)]
+        a = [lanes[i] ^ d[i % 5] for i in range(25)]
+        b = [0] * 25
+        for x in range(5):
+            for y in range(5):
+                b[y + 5 * ((2 * x + 3 * y) % 5)] = rotl64(a[x + 5 * y], KECCAK_ROTATIONS[x + 5 * y])
+        for i in range(25):
+            x, y = i % 5, i // 5
+            lanes[i] = b[i] ^ (~b[(x + 1) % 5 + 5 * y] & b[(x + 2) % 5 + 5 * y] & MASK64)
+        lanes[0] ^= constant
+
+
+def keccak_256(data):
+    """Keccak-256 as used by Ethereum, which is not hashlib's SHA3-256 (different padding)."""
+    rate = 136
+    padded = bytearray(data) + b"\x01" + b"\x00" * (-(len(data) + 1) % rate)
+    padded[-1] |= 0x80
+    lanes = [0] * 25
+    for block in range(0, len(padded), rate):
+        for i in range(rate // 8):
+            start = block + 8 * i
+            lanes[i] ^= int.from_bytes(padded[start:start + 8], "little")
+        keccak_f(lanes)
+    return b"".join(lane.to_bytes(8, "little") for lane in lanes[:4])
+
+
+def eip55_mask(address):
+    """Case mask of the EIP-55 checksum of `address`, one bit per hex character (MSB first)."""
+    digits = address.hex()
+    digest = keccak_256(digits.encode()).hex()
+    mask = bytearray(len(digits) // 8)
+    for i, digit in enumerate(digits):
+        if digit in "abcdef" and int(digest[i], 16) >= 8:
+            mask[i // 8] |= 0x80 >> (i % 8)
+    return bytes(mask)
+
+
+def eip55(address):
+    mask = eip55_mask(address)
+    return "0x" + "".join(d.upper() if mask[i // 8] & (0x80 >> (i % 8)) else d
+                          for i, d in enumerate(address.hex()))
+
+
+def parse_hex(value, length, what):
+    if not re.fullmatch(r"0x[0-9a-fA-F]{%d}" % (2 * length), value):
+        raise RegistryError("%s: expected %d hex bytes, got %r" % (what, length, value))
+    return bytes.fromhex(value[2:])
+
+
+def parse_address(value, what):
+    """Parses an address written in lowercase, uppercase or checksummed (EIP-55) form."""
+    address = parse_hex(value, ADDRESS_LENGTH, what)
+    if value[2:] not in (address.hex(), address.hex().upper()) and value != eip55(address):
+        raise RegistryError("%s: bad checksum for %s, expected %s" % (what, value, eip55(address)))
+    return address
+
+
+def check_batch(name, flow, params):
+    """Checks the layouts that the multicall parser (src/multicall.c) relies on."""
+    flags = flow.get("flags", [])
+    batch_screens = [s for s in flow["screens"] if s.split()[0] == "batch_call"]
+    if ("batch" in flags) != (params == ["calls"]) or ("calls" in params and params != ["calls"]):
+        raise RegistryError("flow %s: \"calls\" must be the only param of a \"batch\" flow" % name)
+    if "batch" in flags and flow["screens"][:MAX_BATCH_CALLS] != ["batch_call"] * MAX_BATCH_CALLS:
+        raise RegistryError("flow %s: must start with %d \"batch_call\" screens" %
+                            (name, MAX_BATCH_CALLS))
+    if "batch" not in flags and batch_screens or len(batch_screens) > MAX_BATCH_CALLS:
+        raise RegistryError("flow %s: unexpected \"batch_call\" screen" % name)
+    if "batchable" in flags:
+        if any(p not in BATCH_PARAMS for p in params) or \
+                any(params.count(p) != 1 for p in ("amount", "vault", "recipient")):
+            raise RegistryError("flow %s: a batchable call has one amount, one vault, one "
+                                "recipient and skipped words" % name)
+        if flow["screens"][0] not in ("amount_want", "amount_vault") or \
+                set(flags) != {"batchable", "vault_from_calldata"}:
+            raise RegistryError("flow %s: a batchable flow shows an amount of a vault from the "
+                                "calldata first" % name)
+
+
+def check_owner(name, flow, selector):
+    """The owner is shown by every flow that parses it, and shares context_t with the vault ticker
+    of token lookups and the calls of a multicall."""
+    has_screen = any(s.split()[0] == "owner" for s in flow["screens"])
+    if ("owner" in selector["params"]) != has_screen:
+        raise RegistryError("%s: an \"owner\" param needs an \"owner\" screen in flow %s, and "
+                            "the other way round" % (selector["enum"], name))
+    if has_screen and set(flow.get("flags", [])) & {"token_lookup", "batch", "batchable"}:
+        raise RegistryError("flow %s: \"owner\" cannot be used with token lookups or "
+                            "multicalls" % name)
+
+
+def load_flow(registry, selector):
+    """Returns the flow of `selector`, with its screens and flags as C expressions."""
+    name = selector.get("flow")
+    if name not in registry.get("flows", {}):
+        raise RegistryError("%s: unknown flow %r" % (selector["enum"], name))
+    flow = registry["flows"][name]
+    screens = []
+    for screen in flow["screens"]:
+        words = screen.split()
+        if words[0] not in SCREENS or not (len(words) == 1 or len(words) == 3 and
+                                           words[1] == "if" and words[2] in SCREEN_CONDITIONS):
+            raise RegistryError("flow %s: invalid screen %r" % (name, screen))
+        screens.append(" | ".join([SCREENS[words[0]]] +
+                                  [SCREEN_CONDITIONS[w] for w in words[2:]]))
+    if not 0 < len(screens) <= MAX_SCREENS_LIMIT:
+        raise RegistryError("flow %s: expected 1 to %d screens" % (name, MAX_SCREENS_LIMIT))
+    for flag in flow.get("flags", []):
+        if flag not in FLOW_FLAGS:
+            raise RegistryError("flow %s: unknown flag %r" % (name, flag))
+    check_batch(name, flow, selector["params"])
+    check_owner(name, flow, selector)
+    return dict(flow, key=name, screens=screens,
+                flags=" | ".join(FLOW_FLAGS[f] for f in flow.get("flags", [])) or "0")
+
+
+def expand_selectors(registry, contract):
+    """Replaces the names of "selectorSets" (e.g. "erc4626") in the selectors of `contract`."""
+    sets = registry.get("selectorSets", {})
+    selectors = []
+    for selector in contract["selectors"]:
+        if selector.startswith("0x"):
+            selectors.append(selector)
+        elif selector in sets:
+            selectors.extend(sets[selector])
+        else:
+            raise RegistryError("%s: unknown selector set %r" %
+                                (contract["contractName"], selector))
+    if len(set(s.lower() for s in selectors)) != len(selectors):
+        raise RegistryError("%s: duplicate selector" % contract["contractName"])
+    return selectors
+
+
+def load_registry(path):
+    with open(path) as f:
+        registry = json.load(f)
+
+    selectors = []
+    seen = set()
+    for entry in registry["selectors"]:
+        value = parse_hex(entry["selector"], SELECTOR_SIZE, "selector")
+        if value in seen:
+            raise RegistryError("duplicate selector %s" % entry["selector"])
+        seen.add(value)
+        # Every selector is parsed: `handle_init_contract` refuses the ones missing from the
+        # generated tables.
+        if "enum" not in entry:
+            raise RegistryError("selector %s: missing enum" % entry["selector"])
+        params = entry.get("params")
+        if params is None:
+            raise RegistryError("%s: missing params" % entry["enum"])
+        for i, param in enumerate(params):
+            if param not in PARAMS:
+                raise RegistryError("%s: unknown param %r" % (entry["enum"], param))
+            if param == "rest" and i != len(params) - 1:
+                raise RegistryError("%s: \"rest\" must be the last param" % entry["enum"])
+        if len(params) > MAX_PARAMS_LIMIT:
+            raise RegistryError("%s: more than %d params" % (entry["enum"], MAX_PARAMS_LIMIT))
+        entry = dict(entry, flow=load_flow(registry, entry))
+        selectors.append(dict(entry, value=value))
+    if len(selectors) >= SELECTOR_NOT_FOUND:
+        raise RegistryError("too many selectors for a uint8_t index")
+
+    chains = registry.get("chains", [])
+    if not 0 < len(chains) < CHAIN_NOT_FOUND:
+        raise RegistryError("expected 1 to %d chains" % (CHAIN_NOT_FOUND - 1))
+    for chain in chains:
+        if not re.fullmatch(r"[a-z][a-z0-9_]*", chain["name"]):
+            raise RegistryError("invalid chain name %r" % chain["name"])
+        if not 0 < chain["chainId"] < 1 << 64 or chain["chainId"] in EIP1191_CHAINS:
+            raise RegistryError("chain %s: unsupported chainId %r" %
+                                (chain["name"], chain["chainId"]))
+        if not 0 < len(chain.get("nativeTicker", "").encode()) < MAX_TICKER_LEN:
+            raise RegistryError("chain %s: nativeTicker missing or longer than %d characters" %
+                                (chain["name"], MAX_TICKER_LEN - 1))
+        if [c["name"] for c in chains].count(chain["name"]) > 1 or \
+                [c["chainId"] for c in chains].count(chain["chainId"]) > 1:
+            raise RegistryError("duplicate chain %s" % chain["name"])
+
+    tables = {chain["name"]: {name: [] for name in TABLES + (ZAP_TOKENS,)} for chain in chains}
+    addresses = set()
+    for contract in registry["contracts"]:
+        name = contract["contractName"]
+        address = parse_address(contract["address"], name)
+        chain = contract.setdefault("chain", chains[0]["name"])
+        if chain not in tables:
+            raise RegistryError("%s: unknown chain %r" % (name, chain))
+        if (chain, address) in addresses:
+            raise RegistryError("%s: duplicate address %s" % (name, contract["address"]))
+        addresses.add((chain, address))
+        contract["selectors"] = expand_selectors(registry, contract)
+        for selector in contract["selectors"]:
+            if parse_hex(selector, SELECTOR_SIZE, name) not in seen:
+                raise RegistryError("%s: selector %s is not in the registry" % (name, selector))
+
+        table = contract.get("table")
+        if table is None:
+            continue
+        if table not in TABLES:
+            raise RegistryError("%s: unknown table %r" % (name, table))
+        for field in ("want", "vault"):
+            if len(contract[field].encode()) >= MAX_VAULT_TICKER_LEN:
+                raise RegistryError("%s: %s %r is longer than %d characters" %
+                                    (name, field, contract[field], MAX_VAULT_TICKER_LEN - 1))
+        if not 0 <= contract["decimals"] <= 0xFF:
+            raise RegistryError("%s: invalid decimals %r" % (name, contract["decimals"]))
+        tables[chain][table].append(dict(contract, value=address))
+
+    for token in registry.get("zapTokens", []):
+        name = token["ticker"]
+        address = parse_address(token["address"], name)
+        chain = token.setdefault("chain", chains[0]["name"])
+        if chain not in tables:
+            raise RegistryError("%s: unknown chain %r" % (name, chain))
+        if any(t["value"] == address for t in tables[chain][ZAP_TOKENS]):
+            raise RegistryError("%s: duplicate zap token %s" % (name, token["address"]))
+        if not 0 < len(name.encode()) < MAX_TICKER_LEN:
+            raise RegistryError("%s: ticker longer than %d characters" %
+                                (name, MAX_TICKER_LEN - 1))
+        if not 0 <= token["decimals"] <= 0xFF:
+            raise RegistryError("%s: invalid decimals %r" % (name, token["decimals"]))
+        tables[chain][ZAP_TOKENS].append(dict(token, value=address))
+
+    for chain, chain_tables in tables.items():
+        for name, entries in chain_tables.items():
+            if len(entries) >= VAULT_NOT_FOUND:
+                raise RegistryError("too many entries in %s for a uint8_t index" %
+                                    table_name(name, chain))
+            entries.sort(key=lambda e: e["value"])
+
+    return registry, selectors, tables
+
+
+def table_name(table, chain):
+    return "%s_%s" % (table, chain.upper())
+
+
+class TickerPool:
+    """Deduplicated pool of length-prefixed strings."""
+
+    def __init__(self):
+        self.strings = []
+        self.offsets = {}
+        self.size = 0
+
+    def add(self, string):
+        if string not in self.offsets:
+            self.offsets[string] = self.size
+            self.strings.append(string)
+            self.size += 1 + len(string.encode())
+        return self.offsets[string]
+
+
+def prefix_enum(prefix):
+    name = re.sub(r"[^0-9A-Za-z]", "", prefix).upper()
+    return "VAULT_PREFIX_%s" % (name or "NONE")
+
+
+def build_pool(registry, tables):
+    """Adds want/vault pool offsets and the vault name prefix to every table entry, the ticker
+    offset to every zap token and the native ticker offset to every chain."""
+    pool = TickerPool()
+    prefixes = [""] + registry.get("vaultPrefixes", [])
+    for prefix in prefixes:
+        pool.add(prefix)
+    # Longest prefix first so that "yvCurve-" wins over "yv", the empty one always matches.
+    candidates = sorted(prefixes, key=len, reverse=True)
+    for chain_tables in tables.values():
+        for table in TABLES:
+            for entry in chain_tables[table]:
+                entry["want_offset"] = pool.add(entry["want"])
+                prefix = next(p for p in candidates if entry["vault"].startswith(p))
+                entry["prefix"] = prefix
+                entry["vault_offset"] = pool.add(entry["vault"][len(prefix):])
+        for entry in chain_tables[ZAP_TOKENS]:
+            entry["ticker_offset"] = pool.add(entry["ticker"])
+    for chain in registry["chains"]:
+        chain["native_offset"] = pool.add(chain["nativeTicker"])
+    if pool.size > 0xFFFF:
+        raise RegistryError("ticker pool too large for uint16_t offsets")
+    return pool, prefixes
+
+
+def c_bytes(value):
+    return ["0x%02x" % b for b in value]
+
+
+def destination_fingerprints(registry):
+    """First 4 bytes of every contract address, all chains, as sorted unique uint32_t."""
+    return sorted({int.from_bytes(parse_hex(c["address"], ADDRESS_LENGTH, c["contractName"])[:4],
+                                  "big") for c in registry["contracts"]})
+
+
+def gen_header(selectors, tables, pool, prefixes, fingerprints):
+    enums = [s["enum"] for s in selectors]
+    lines = [
+        HEADER_COMMENT,
+        "#pragma once",
+        "",
+        "#define NUM_SELECTORS      %d" % len(enums),
+        "#define NUM_CHAINS         %d" % len(tables),
+        "#define MAX_TABLE_SIZE     %d" % max(len(entries) for chain_tables in tables.values()
+                                              for entries in chain_tables.values()),
+        "#define NUM_VAULT_PREFIXES %d" % len(prefixes),
+        "#define MAX_PARAMS         %d" % max([len(s["params"]) for s in selectors] + [1]),
+        "#define MAX_SCREENS        %d" % max([len(s["flow"]["screens"]) for s in selectors] + [1]),
+        "#define TICKER_POOL_SIZE   %d" % pool.size,
+        "#define NUM_DESTINATIONS   %d" % len(fingerprints),
+        "",
+        "// Enumeration of the different selectors possible, in the order of YEARN_SELECTORS.",
+        "typedef enum {",
+    ]
+    lines += ["    %s," % enum for enum in enums]
+    lines += [
+        "} selector_t;",
+        "",
+        "// Prefix of a vault name, in the order of VAULT_PREFIXES.",
+        "typedef enum {",
+    ]
+    # Trailing comments aligned as clang-format (AlignTrailingComments) aligns them.
+    width = max(len(prefix_enum(p)) for p in prefixes) + 1
+    lines += ["    %-*s  // \"%s\"" % (width, prefix_enum(p) + ",", p) for p in prefixes]
+    lines += ["} vault_prefix_t;"]
+    return "\n".join(lines) + "\n"
+
+
+def c_pool_string(string):
+    # Separate literals so that the length escape cannot swallow the first characters.
+    return '"\\x%02x" %s' % (len(string.encode()), json.dumps(string))
+
+
+def gen_source(registry, selectors, tables, pool, prefixes, fingerprints):
+    lines = [HEADER_COMMENT, '#include "yearn_plugin.h"', ""]
+
+    for s in selectors:
+        lines.append("static const uint8_t %s_SELECTOR[SELECTOR_SIZE] = {%s};" %
+                     (s["enum"], ", ".join(c_bytes(s["value"]))))
+    lines.append("")
+    lines.append("// Array of all the different boilerplate selectors, in `selector_t` order.")
+    prefix = "const uint8_t *const YEARN_SELECTORS[NUM_SELECTORS] = {"
+    for i, s in enumerate(selectors):
+        start = prefix if i == 0 else " " * len(prefix)
+        end = "};" if i == len(selectors) - 1 else ","
+        lines.append("%s%s_SELECTOR%s" % (start, s["enum"], end))
+
+    lines.append("")
+    lines.append("// Calldata words of each selector, in `selector_t` order, see "
+                 "`handle_provide_parameter`.")
+    lines.append("const param_slot_t PARAMETER_SCHEMAS[NUM_SELECTORS][MAX_PARAMS] = {")
+    for i, s in enumerate(selectors):
+        slots = []
+        for param in s["params"]:
+            kind, field = PARAMS[param]
+            slots.append("{%s, %s}" % (kind, "offsetof(context_t, %s)" % field if field else "0"))
+        end = "};" if i == len(selectors) - 1 else ","
+        lines.append("    // %s: %s" % (s["enum"], ", ".join(s["params"]) or "no parameter"))
+        slots = slots or ["{PARAM_END, 0}"]
+        for j, slot in enumerate(slots):
+            start = "    {" if j == 0 else "     "
+            lines.append("%s%s%s" % (start, slot, "}" + end if j == len(slots) - 1 else ","))
+
+    lines.append("")
+    lines.append("// Name, version and screens of each selector, in `selector_t` order, see "
+                 "`get_flow`.")
+    lines.append("const flow_t FLOWS[NUM_SELECTORS] = {")
+    for i, s in enumerate(selectors):
+        flow = s["flow"]
+        lines.append("    // %s: %s" % (s["enum"], flow["key"]))
+        lines.append("    {%s, %s, %s," % (json.dumps(flow["name"]), json.dumps(flow["version"]),
+                                          flow["flags"]))
+        end = "};" if i == len(selectors) - 1 else ","
+        screens = "     {%s}}%s" % (", ".join(flow["screens"]), end)
+        if len(screens) > 100:
+            screens = ",\n      ".join(flow["screens"])
+            screens = "     {%s}}%s" % (screens, end)
+        lines.append(screens)
+
+    lines.append("")
+    lines.append("// First 4 bytes of the address of every contract, all chains, sorted: see "
+                 "`is_known_destination`.")
+    lines.append("const uint32_t DESTINATION_FINGERPRINTS[NUM_DESTINATIONS] = {")
+    for i in range(0, len(fingerprints), 7):
+        row = ", ".join("0x%08Xu" % f for f in fingerprints[i:i + 7])
+        lines.append("    %s%s" % (row, "};" if i + 7 >= len(fingerprints) else ","))
+
+    lines.append("")
+    lines.append("// Length-prefixed tickers, referenced by their offset in the pool.")
+    lines.append("const char TICKER_POOL[TICKER_POOL_SIZE] =")
+    for i, string in enumerate(pool.strings):
+        end = ";" if i == len(pool.strings) - 1 else ""
+        lines.append("    %s%s  // %d" % (c_pool_string(string), end, pool.offsets[string]))
+
+    lines.append("")
+    lines.append("// Offset in TICKER_POOL of each `vault_prefix_t`.")
+    lines.append("const uint16_t VAULT_PREFIXES[NUM_VAULT_PREFIXES] = {%s};" %
+                 ", ".join(str(pool.offsets[p]) for p in prefixes))
+
+    for chain, chain_tables in tables.items():
+        for table in TABLES:
+            entries = chain_tables[table]
+            if entries:
+                lines += gen_table(table_name(table, chain), entries)
+        if chain_tables[ZAP_TOKENS]:
+            lines += gen_token_table(table_name(ZAP_TOKENS, chain), chain_tables[ZAP_TOKENS])
+
+    lines.append("")
+    lines.append("// Vault and zap token tables of each chain, see `find_chain_index`.")
+    lines.append("const chain_t CHAINS[NUM_CHAINS] = {")
+    for i, chain in enumerate(registry["chains"]):
+        fields = [str(chain["chainId"])]
+        for table in TABLES + (ZAP_TOKENS,):
+            fields.append(table_name(table, chain["name"])
+                          if tables[chain["name"]][table] else "NULL")
+        fields += [str(len(tables[chain["name"]][table])) for table in TABLES + (ZAP_TOKENS,)]
+        fields.append(str(chain["native_offset"]))
+        lines.append("    // %s" % chain["name"])
+        lines.append("    {%s}%s" % (", ".join(fields), "};" if i == len(tables) - 1 else ","))
+    return "\n".join(lines) + "\n"
+
+
+def gen_table(name, entries):
+    lines = [
+        "",
+        "// Sorted by address, see `find_vault_index`.",
+        "static const yearnVaultDefinition_t %s[%d] = {" % (name, len(entries)),
+    ]
+    for i, entry in enumerate(entries):
+        address = c_bytes(entry["value"])
+        lines.append("    // %s, %s, %s" % (entry["want"], entry["vault"], eip55(entry["value"])))
+        lines.append("    {{%s," % ", ".join(address[:10]))
+        lines.append("      %s}," % ", ".join(address[10:]))
+        lines.append("     %d," % entry["want_offset"])
+        lines.append("     %d," % entry["vault_offset"])
+        lines.append("     %s," % prefix_enum(entry["prefix"]))
+        lines.append("     %d," % entry["decimals"])
+        lines.append("     {%s}}%s" % (", ".join(c_bytes(eip55_mask(entry["value"]))),
+                                      "};" if i == len(entries) - 1 else ","))
+    return lines
+
+
+def gen_token_table(name, entries):
+    lines = [
+        "",
+        "// Sorted by address, see `get_zap_token`.",
+        "static const zapTokenDefinition_t %s[%d] = {" % (name, len(entries)),
+    ]
+    for i, entry in enumerate(entries):
+        address = c_bytes(entry["value"])
+        lines.append("    // %s, %s" % (entry["ticker"], eip55(entry["value"])))
+        lines.append("    {{%s," % ", ".join(address[:10]))
+        lines.append("      %s}," % ", ".join(address[10:]))
+        lines.append("     %d," % entry["ticker_offset"])
+        lines.append("     %d}%s" % (entry["decimals"], "};" if i == len(entries) - 1 else ","))
+    return lines
+
+
+def hash_slot(value, multiplier, bits):
+    return ((value * multiplier) & 0xFFFFFFFF) >> (32 - bits)
+
+
+def find_multiplier(values, bits, tries=1 << 20):
+    # Deterministic sequence of odd multipliers, starting from the golden ratio constant.
+    multiplier = 0x9E3779B1
+    for _ in range(tries):
+        if len({hash_slot(v, multiplier, bits) for v in values}) == len(values):
+            return multiplier
+        multiplier = (multiplier + 0x6A09E667) & 0xFFFFFFFF | 1
+    return None
+
+
+def gen_selector_hash(selectors):
+    values = [int.from_bytes(s["value"], "big") for s in selectors]
+
+    bits = max(1, (len(values) - 1).bit_length())
+    multiplier = find_multiplier(values, bits)
+    while multiplier is None:
+        bits += 1
+        if bits > 8:
+            raise RegistryError("no collision-free selector hash found")
+        multiplier = find_multiplier(values, bits)
+
+    table = [SELECTOR_NOT_FOUND] * (1 << bits)
+    for index, value in enumerate(values):
+        slot = hash_slot(value, multiplier, bits)
+        if table[slot] != SELECTOR_NOT_FOUND:
+            raise RegistryError("selector hash collision")
+        table[slot] = index
+
+    lines = [
+        HEADER_COMMENT,
+        "// Perfect hash over YEARN_SELECTORS: a selector read as a big-endian uint32_t lands in",
+        "// slot (selector * SELECTOR_HASH_MULTIPLIER) >> (32 - SELECTOR_HASH_BITS).",
+        "#pragma once",
+        "",
+        '#include "yearn_plugin.h"',
+        "",
+        "#define SELECTOR_HASH_MULTIPLIER 0x%08Xu" % multiplier,
+        "#define SELECTOR_HASH_BITS       %d" % bits,
+        "#define SELECTOR_NOT_FOUND       0x%02X" % SELECTOR_NOT_FOUND,
+        "",
+        "static const uint8_t SELECTOR_HASH_TABLE[1 << SELECTOR_HASH_BITS] = {",
+    ]
+    for index in table:
+        if index == SELECTOR_NOT_FOUND:
+            lines.append("    SELECTOR_NOT_FOUND,")
+        else:
+            lines.append("    %s," % selectors[index]["enum"])
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def gen_b2c(registry, selectors):
+    by_value = {s["selector"].lower(): s for s in selectors}
+    chain = registry["chains"][0]
+    contracts = []
+    for contract in registry["contracts"]:
+        if contract["chain"] != chain["name"]:
+            continue
+        abi = os.path.join(ABIS, contract["address"].lower() + ".json")
+        if not os.path.exists(os.path.join(ROOT, abi)):
+            raise RegistryError("%s: no ABI in %s" % (contract["contractName"], abi))
+        methods = []
+        for selector in contract["selectors"]:
+            s = by_value[selector.lower()]
+            methods.append("\n".join([
+                '            "%s": {' % selector.lower(),
+                '                "erc20OfInterest": %s,' % json.dumps(s["erc20OfInterest"]),
+                '                "method": %s,' % json.dumps(s["method"]),
+                '                "plugin": %s' % json.dumps(registry["name"]),
+                "            }",
+            ]))
+        contracts.append("\n".join([
+            '        "address": "%s",' % contract["address"].lower(),
+            '        "contractName": %s,' % json.dumps(contract["contractName"]),
+            '        "selectors": {',
+            ",\n".join(methods),
+            "        }",
+        ]))
+    return "\n".join([
+        "{",
+        '    "chainId": %d,' % chain["chainId"],
+        '    "contracts": [{',
+        "\n    }, {\n".join(contracts),
+        "    }],",
+        '    "name": %s' % json.dumps(registry["name"]),
+        "}",
+    ]) + "\n"
+
+
+def generate():
+    registry, selectors, tables = load_registry(os.path.join(ROOT, REGISTRY))
+    pool, prefixes = build_pool(registry, tables)
+    fingerprints = destination_fingerprints(registry)
+    return {
+        "src/yearn_registry.h": gen_header(selectors, tables, pool, prefixes, fingerprints),
+        "src/yearn_registry.c": gen_source(registry, selectors, tables, pool, prefixes,
+                                           fingerprints),
+        "src/selector_hash.h": gen_selector_hash(selectors),
+        "tests/yearn/b2c.json": gen_b2c(registry, selectors),
+    }
+
+
+def main(argv):
+    check = "--check" in argv
+    try:
+        outputs = generate()
+    except (RegistryError, KeyError, ValueError) as e:
+        print("%s: %s" % (REGISTRY, e), file=sys.stderr)
+        return 1
+
+    stale = []
+    for path, content in outputs.items():
+        full_path = os.path.join(ROOT, path)
+        current = None
+        if os.path.exists(full_path):
+            with open(full_path) as f:
+                current = f.read()
+        if current == content:
+            continue
+        if check:
+            stale.append(path)
+        else:
+            with open(full_path, "w") as f:
+                f.write(content)
+            print("Generated %s" % path)
+
+    for path in stale:
+        print("%s is out of date, run `make registry`" % path, file=sys.stderr)
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
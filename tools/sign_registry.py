@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""Build and sign a vault registry update, loaded in NVM by src/nvm_registry.c.
+
+An update adds vaults and Iron Bank markets to the tables built into the app,
+for one chain, without a new build. It is a JSON file:
+
+  {"chainId": 1, "sequence": 2, "contracts": [
+      {"address": "0x...", "contractName": "...", "table": "YEARN_VAULTS",
+       "want": "USDC", "vault": "yvUSDC", "decimals": 6}, ...]}
+
+with the fields of the vault entries of registry/yearn.json. The device only
+accepts an update whose "sequence" is greater than the last one it loaded.
+
+The signed blob, all integers big-endian:
+
+  header   "YRNR", version, sequence (4), chainId (8), vault and market counts
+           (1 each), pool size (2)
+  entries  address (20), want and vault offsets in the pool (2 each), vault
+           prefix (always 0, the full name is in the pool), decimals, EIP-55 case
+           mask of the address (5); vaults then markets, each sorted by address
+  pool     length-prefixed tickers
+
+followed by the DER-encoded ECDSA (secp256k1) signature of its SHA-256, sent
+separately. Keys are 32-byte secp256k1 private keys written in hex.
+
+Usage:
+  sign_registry.py <update.json> <key>     print the blob and its signature, in hex
+  sign_registry.py --public-key <key>      print the public key, as a C initializer
+"""
+
+import hashlib
+import hmac
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gen_registry import (MAX_VAULT_TICKER_LEN, TABLES, RegistryError,  # noqa: E402
+                          TickerPool, eip55_mask, parse_address)
+
+MAGIC = b"YRNR"
+VERSION = 1
+MAX_VAULTS = 64  # Must match NVM_REGISTRY_MAX_VAULTS in yearn_plugin.h, both tables together.
+POOL_SIZE = 1024  # Must match NVM_REGISTRY_POOL_SIZE in yearn_plugin.h.
+
+# secp256k1
+P = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F
+N = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+G = (0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+     0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8)
+
+
+def point_add(a, b):
+    if a is None:
+        return b
+    if b is None:
+        return a
+    if a[0] == b[0] and (a[1] + b[1]) % P == 0:
+        return None
+    if a == b:
+        slope = 3 * a[0] * a[0] * pow(2 * a[1], P - 2, P)
+    else:
+        slope = (b[1] - a[1]) * pow(b[0] - a[0], P - 2, P)
+    x = (slope * slope - a[0] - b[0]) % P
+    return x, (slope * (a[0] - x) - a[1]) % P
+
+
+def point_mul(k, point):
+    result = None
+    while k:
+        if k & 1:
+            result = point_add(result, point)
+        point = point_add(point, point)
+        k >>= 1
+    return result
+
+
+def rfc6979_nonce(key, digest):
+    """Deterministic nonce (RFC 6979, HMAC-SHA256): the same update always gets the same blob."""
+    x = key.to_bytes(32, "big")
+    h = (int.from_bytes(digest, "big") % N).to_bytes(32, "big")
+    v, k = b"\x01" * 32, b"\x00" * 32
+    k = hmac.new(k, v + b"\x00" + x + h, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    k = hmac.new(k, v + b"\x01" + x + h, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    while True:
+        v = hmac.new(k, v, hashlib.sha256).digest()
+        nonce = int.from_bytes(v, "big")
+        if 0 < nonce < N:
+            return nonce
+        k = hmac.new(k, v + b"\x00", hashlib.sha256).digest()
+        v = hmac.new(k, v, hashlib.sha256).digest()
+
+
+def der_integer(value):
+    encoded = value.to_bytes((value.bit_length() + 8) // 8, "big")
+    return b"\x02" + bytes([len(encoded)]) + encoded
+
+
+def sign(key, digest):
+    """DER-encoded low-S signature of `digest`, as cx_ecdsa_verify expects."""
+    z = int.from_bytes(digest, "big")
+    nonce = rfc6979_nonce(key, digest)
+    r = point_mul(nonce, G)[0] % N
+    s = pow(nonce, N - 2, N) * (z + r * key) % N
+    s = min(s, N - s)
+    body = der_integer(r) + der_integer(s)
+    return b"\x30" + bytes([len(body)]) + body
+
+
+def public_key(key):
+    x, y = point_mul(key, G)
+    return b"\x04" + x.to_bytes(32, "big") + y.to_bytes(32, "big")
+
+
+def load_key(path):
+    with open(path) as f:
+        key = int(f.read().strip(), 16)
+    if not 0 < key < N:
+        raise RegistryError("%s: invalid private key" % path)
+    return key
+
+
+def build_blob(update):
+    tables = {table: [] for table in TABLES}
+    for contract in update["contracts"]:
+        name = contract["contractName"]
+        address = parse_address(contract["address"], name)
+        table = contract.get("table")
+        if table not in TABLES:
+            raise RegistryError("%s: unknown table %r" % (name, table))
+        if any(e["value"] == address for e in tables[table]):
+            raise RegistryError("%s: duplicate address %s" % (name, contract["address"]))
+        for field in ("want", "vault"):
+            if not 0 < len(contract[field].encode()) < MAX_VAULT_TICKER_LEN:
+                raise RegistryError("%s: invalid %s %r" % (name, field, contract[field]))
+        if not 0 <= contract["decimals"] <= 0xFF:
+            raise RegistryError("%s: invalid decimals %r" % (name, contract["decimals"]))
+        tables[table].append(dict(contract, value=address))
+
+    entries = []
+    pool = TickerPool()
+    for table in TABLES:
+        entries += sorted(tables[table], key=lambda e: e["value"])
+    if len(entries) > MAX_VAULTS:
+        raise RegistryError("more than %d vaults and markets" % MAX_VAULTS)
+    body = b""
+    for entry in entries:
+        body += entry["value"]
+        body += pool.add(entry["want"]).to_bytes(2, "big")
+        body += pool.add(entry["vault"]).to_bytes(2, "big")
+        body += bytes([0, entry["decimals"]])
+        body += eip55_mask(entry["value"])
+    if pool.size > POOL_SIZE:
+        raise RegistryError("ticker pool larger than %d bytes" % POOL_SIZE)
+    if not 0 < update["sequence"] < 1 << 32 or not 0 < update["chainId"] < 1 << 64:
+        raise RegistryError("invalid sequence or chainId")
+
+    header = MAGIC + bytes([VERSION])
+    header += update["sequence"].to_bytes(4, "big") + update["chainId"].to_bytes(8, "big")
+    header += bytes([len(tables["YEARN_VAULTS"]), len(tables["IRON_BANK"])])
+    header += pool.size.to_bytes(2, "big")
+    return header + body + b"".join(bytes([len(s.encode())]) + s.encode() for s in pool.strings)
+
+
+def main(argv):
+    try:
+        if len(argv) == 2 and argv[0] == "--public-key":
+            key = public_key(load_key(argv[1]))
+            for i in range(0, len(key), 12):
+                print("    %s," % ", ".join("0x%02x" % b for b in key[i:i + 12]))
+            return 0
+        if len(argv) != 2:
+            print("\n".join(__doc__.strip().splitlines()[-3:]), file=sys.stderr)
+            return 2
+        with open(argv[0]) as f:
+            blob = build_blob(json.load(f))
+        print(blob.hex())
+        print(sign(load_key(argv[1]), hashlib.sha256(blob).digest()).hex())
+    except (RegistryError, KeyError, ValueError, OSError) as e:
+        print("%s: %s" % (argv[0] if argv else "sign_registry.py", e), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))